@@ -228,8 +228,7 @@ Expression *arrayOp(BinExp *e, Scope *sc)
     char *name = buf.peekString();
     Identifier *ident = Lexer::idPool(name);
 
-    FuncDeclaration **pFd = (FuncDeclaration **)_aaGet(&arrayfuncs, ident);
-    FuncDeclaration *fd = *pFd;
+    FuncDeclaration *fd = (FuncDeclaration *)_aaGetRvalue(arrayfuncs, ident);
 
     if (!fd)
         fd = buildArrayOp(ident, e, sc, e->loc);
@@ -248,7 +247,7 @@ Expression *arrayOp(BinExp *e, Scope *sc)
         return new ErrorExp();
     }
 
-    *pFd = fd;
+    *(FuncDeclaration **)_aaGet(&arrayfuncs, ident) = fd;
 
     Expression *ev = new VarExp(e->loc, fd);
     Expression *ec = new CallExp(e->loc, ev, arguments);
@@ -1630,7 +1630,13 @@ Expression *castTo(Expression *e, Scope *sc, Type *t)
                     break;
 
                 case X(Tchar, Twchar):
-                    for (size_t u = 0; u < e->len;)
+                {
+                    // Convert the valid prefix in bulk, then the rest one by one
+                    buffer.reserve(e->len * 2);
+                    size_t n;
+                    size_t u = utf_toUTF16((utf8_t *)se->string, e->len, (utf16_t *)buffer.data, &n);
+                    buffer.offset = n * 2;
+                    while (u < e->len)
                     {
                         unsigned c;
                         const char *p = utf_decodeChar((utf8_t *)se->string, e->len, &u, &c);
@@ -1642,9 +1648,14 @@ Expression *castTo(Expression *e, Scope *sc, Type *t)
                     newlen = buffer.offset / 2;
                     buffer.writeUTF16(0);
                     goto L1;
+                }
 
                 case X(Tchar, Tdchar):
-                    for (size_t u = 0; u < e->len;)
+                {
+                    buffer.reserve(e->len * 4);
+                    size_t u = utf_toUTF32((utf8_t *)se->string, e->len, (utf32_t *)buffer.data, &newlen);
+                    buffer.offset = newlen * 4;
+                    while (u < e->len)
                     {
                         unsigned c;
                         const char *p = utf_decodeChar((utf8_t *)se->string, e->len, &u, &c);
@@ -1655,9 +1666,13 @@ Expression *castTo(Expression *e, Scope *sc, Type *t)
                     }
                     buffer.write4(0);
                     goto L1;
+                }
 
                 case X(Twchar,Tchar):
-                    for (size_t u = 0; u < e->len;)
+                {
+                    buffer.reserve(e->len * 3);
+                    size_t u = utf_fromUTF16((utf16_t *)se->string, e->len, buffer.data, &buffer.offset);
+                    while (u < e->len)
                     {
                         unsigned c;
                         const char *p = utf_decodeWchar((unsigned short *)se->string, e->len, &u, &c);
@@ -1669,6 +1684,7 @@ Expression *castTo(Expression *e, Scope *sc, Type *t)
                     newlen = buffer.offset;
                     buffer.writeUTF8(0);
                     goto L1;
+                }
 
                 case X(Twchar,Tdchar):
                     for (size_t u = 0; u < e->len;)
@@ -1684,7 +1700,10 @@ Expression *castTo(Expression *e, Scope *sc, Type *t)
                     goto L1;
 
                 case X(Tdchar,Tchar):
-                    for (size_t u = 0; u < e->len; u++)
+                {
+                    buffer.reserve(e->len * 4);
+                    size_t u = utf_fromUTF32((utf32_t *)se->string, e->len, buffer.data, &buffer.offset);
+                    for (; u < e->len; u++)
                     {
                         unsigned c = ((unsigned *)se->string)[u];
                         if (!utf_isValidDchar(c))
@@ -1696,6 +1715,7 @@ Expression *castTo(Expression *e, Scope *sc, Type *t)
                     newlen = buffer.offset;
                     buffer.writeUTF8(0);
                     goto L1;
+                }
 
                 case X(Tdchar,Twchar):
                     for (size_t u = 0; u < e->len; u++)
@@ -0,0 +1,183 @@
+code *(*cdxxx[OPMAX]) (elem *,regm_t *) = 
+	{
+	cderr,
+	cdorth,
+	cdorth,
+	cdmul,
+	cdmul,
+	cdmul,
+	cdshift,
+	cdshift,
+	cdorth,
+	cdorth,
+	cdorth,
+	cdshift,
+	cdnot,
+	cdnot,
+	cdcom,
+	cdcond,
+	cdcomma,
+	cdloglog,
+	cdloglog,
+	cderr,
+	cdind,
+	cderr,
+	cdneg,
+	cderr,
+	cdvoid,
+	cdabs,
+	cdrndtol,
+	cdneg,
+	cdneg,
+	cdneg,
+	cdneg,
+	cdscale,
+	cdscale,
+	cdscale,
+	cdstrlen,
+	cdstrcpy,
+	cderr,
+	cdstrcmp,
+	cdmemcpy,
+	cdmemcmp,
+	cdmemset,
+	cdsetjmp,
+	cdmul,
+	cdbscan,
+	cdbscan,
+	cdbt,
+	cdbt,
+	cdbt,
+	cdbt,
+	cdbswap,
+	cdshift,
+	cdshift,
+	cdbtst,
+	cdstreq,
+	cdaddass,
+	cdpost,
+	cdpost,
+	cdeq,
+	cdaddass,
+	cdaddass,
+	cdmulass,
+	cdmulass,
+	cdmulass,
+	cdshass,
+	cdshass,
+	cdaddass,
+	cdaddass,
+	cdaddass,
+	cdshass,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcmp,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdshtlng,
+	cdshtlng,
+	cdlngsht,
+	cdbyteint,
+	cdbyteint,
+	cdlngsht,
+	cdshtlng,
+	cdshtlng,
+	cdlngsht,
+	cdshtlng,
+	cdshtlng,
+	cdlngsht,
+	cdcnvt,
+	cdcnvt,
+	cdcnvt,
+	cdconvt87,
+	cdconvt87,
+	cdmsw,
+	cderr,
+	cdfunc,
+	cdfunc,
+	cdfunc,
+	cdfunc,
+	cderr,
+	cderr,
+	cdstrthis,
+	cderr,
+	cderr,
+	cdrelconst,
+	loaddata,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cdasm,
+	cdinfo,
+	cdhalt,
+	cdctor,
+	cddtor,
+	cdmark,
+	cddctor,
+	cdddtor,
+	cdpair,
+	cdpair,
+	cdframeptr,
+	cdgot,
+	cdvector,
+	cdvecsto,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cdnullcheck,
+	cdport,
+	cdport,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr,
+	cderr
+	};
@@ -113,6 +113,10 @@ bool needToCopyLiteral(Expression *expr);
 /// This value will be used for in-place modification.
 Expression *copyLiteral(Expression *e);
 
+/// True if se has the same data as e, a string literal not owned by CTFE,
+/// so that se must be copied before it is modified.
+bool sharesLiteral(StringExp *se, Expression *e);
+
 /// Set this literal to the given type, copying it if necessary
 Expression *paintTypeOntoLiteral(Type *type, Expression *lit);
 
@@ -148,7 +148,7 @@ void ThrownExceptionExp::generateUncaughtError()
      * in the case where the ThrowStatement is generated internally
      * (eg, in ScopeStatement)
      */
-    if (loc.filename && !loc.equals(thrown->loc))
+    if (loc.filename() && !loc.equals(thrown->loc))
         errorSupplemental(loc, "thrown from here");
 }
 
@@ -338,6 +338,17 @@ Expression *copyLiteral(Expression *e)
     }
 }
 
+/* True if se has the same data as e, which is a string literal
+ * that CTFE does not own. Literals share their data (see
+ * Lexer::literalPool()), so se must not be written to.
+ */
+bool sharesLiteral(StringExp *se, Expression *e)
+{
+    return e->op == TOKstring &&
+        !((StringExp *)e)->ownedByCtfe &&
+        ((StringExp *)e)->string == se->string;
+}
+
 /* Deal with type painting.
  * Type painting is a major nuisance: we can't just set
  * e->type = type, because that would change the original literal.
@@ -1694,8 +1705,8 @@ Expression *ctfeCast(Loc loc, Type *type, Type *to, Expression *e)
         error(loc, "cannot cast %s to %s at compile time", e->toChars(), to->toChars());
     if (e->op == TOKarrayliteral)
         ((ArrayLiteralExp *)e)->ownedByCtfe = true;
-    if (e->op == TOKstring)
-        ((StringExp *)e)->ownedByCtfe = true;
+    if (e->op == TOKstring && r->op == TOKstring && !sharesLiteral((StringExp *)r, e))
+        ((StringExp *)r)->ownedByCtfe = true;
     return r;
 }
 
@@ -0,0 +1,183 @@
+static const char *debtab[OPMAX] = 
+	{
+	"unde",
+	"+",
+	"-",
+	"*",
+	"/",
+	"%",
+	">>>",
+	"<<",
+	"&",
+	"^",
+	"|",
+	">>",
+	"!",
+	"bool",
+	"~",
+	"?",
+	",",
+	"||",
+	"&&",
+	"bit",
+	"*",
+	"&",
+	"-",
+	"+",
+	"void",
+	"abs",
+	"rndtol",
+	"rint",
+	"sqrt",
+	"sin",
+	"cos",
+	"scale",
+	"yl2x",
+	"yl2xp1",
+	"strlen",
+	"strcpy",
+	"strcat",
+	"strcmp",
+	"memcpy",
+	"memcmp",
+	"memset",
+	"setjmp",
+	"/%",
+	"bsf",
+	"bsr",
+	"bt",
+	"btc",
+	"btr",
+	"bts",
+	"bswap",
+	"<<|",
+	">>|",
+	"btst",
+	"streq",
+	"negass",
+	"++",
+	"--",
+	"=",
+	"+=",
+	"-=",
+	"*=",
+	"/=",
+	"%=",
+	">>>=",
+	"<<=",
+	"&=",
+	"^=",
+	"|=",
+	">>=",
+	"<=",
+	">",
+	"<",
+	">=",
+	"==",
+	"!=",
+	"!<>=",
+	"<>",
+	"<>=",
+	"!>",
+	"!>=",
+	"!<",
+	"!<=",
+	"!<>",
+	"~>",
+	"~>=",
+	"~<",
+	"~<=",
+	"~!<>=",
+	"~<>",
+	"~<>=",
+	"~!>",
+	"~!>=",
+	"~!<",
+	"~!<=",
+	"~!<>",
+	"b_8",
+	"d_s32",
+	"s32_d",
+	"d_s16",
+	"s16_d",
+	"d_u16",
+	"u16_d",
+	"d_u32",
+	"u32_d",
+	"d_s64",
+	"s64_d",
+	"d_u64",
+	"u64_d",
+	"d_f",
+	"f_d",
+	"s16_32",
+	"u16_32",
+	"32_16",
+	"u8_16",
+	"s8_16",
+	"16_8",
+	"u32_64",
+	"s32_64",
+	"64_32",
+	"u64_128",
+	"s64_128",
+	"128_64",
+	"ld_d",
+	"d_ld",
+	"ld_u64",
+	"c_r",
+	"c_i",
+	"msw",
+	"param",
+	"call",
+	"ucall",
+	"callns",
+	"ucallns",
+	"sizeof",
+	"strctor",
+	"strthis",
+	"strpar",
+	"const",
+	"relconst",
+	"var",
+	"reg",
+	"colon",
+	"colon2",
+	"string",
+	"nullptr",
+	"asm",
+	"info",
+	"halt",
+	"ctor",
+	"dtor",
+	"mark",
+	"dctor",
+	"ddtor",
+	"pair",
+	"rpair",
+	"frameptr",
+	"got",
+	"vector",
+	"vecsto",
+	"array",
+	"length",
+	"field",
+	"newarray",
+	"mnewarray",
+	"instanceof",
+	"finalinstanceof",
+	"checkcast",
+	"hstring",
+	"nullcheck",
+	"inp",
+	"outp",
+	"new",
+	"new[]",
+	"delete",
+	"delete[]",
+	"brack",
+	"->",
+	"->*",
+	"U++",
+	"U--"
+	};
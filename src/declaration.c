@@ -1965,7 +1965,7 @@ void VarDeclaration::checkNestedReference(Scope *sc, Loc loc)
                 //printf("\tfdv = %s\n", fdv->toChars());
                 //printf("\tfdthis = %s\n", fdthis->toChars());
 
-                if (loc.filename)
+                if (loc.filename())
                     fdthis->getLevel(loc, sc, fdv);
 
                 // Function literals from fdthis to fdv must be delegates
@@ -2055,6 +2055,7 @@ Expression *VarDeclaration::getConstInitializer(bool needFullType)
 
     if (scope)
     {
+        mem.keepRegions();
         inuse++;
         init = init->semantic(scope, type, INITinterpret);
         scope = NULL;
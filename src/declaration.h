@@ -32,6 +32,7 @@ class StructDeclaration;
 struct InterState;
 struct IRState;
 struct CompiledCtfeFunction;
+struct LazyBody;
 
 enum PROT;
 enum LINK;
@@ -124,10 +125,10 @@ public:
     Type *type;
     Type *originalType;         // before semantic analysis
     StorageClass storage_class;
+    const char *mangleOverride;      // overridden symbol with pragma(mangle, "...")
     PROT protection;
     LINK linkage;
     int inuse;                  // used to detect cycles
-    const char *mangleOverride;      // overridden symbol with pragma(mangle, "...")
     Semantic sem;
 
     Declaration(Identifier *id);
@@ -270,18 +271,18 @@ class VarDeclaration : public Declaration
 public:
     Initializer *init;
     unsigned offset;
-    bool noscope;                // no auto semantics
+    structalign_t alignment;
     FuncDeclarations nestedrefs; // referenced by these lexically nested functions
+    bool noscope;                // no auto semantics
     bool isargptr;              // if parameter that _argptr points to
-    structalign_t alignment;
     bool ctorinit;              // it has been initialized in a ctor
+    bool overlapped;            // if it is a field and has overlapping
     short onstack;              // 1: it has been allocated on the stack
                                 // 2: on stack, run destructor anyway
-    int canassign;              // it can be assigned to
-    bool overlapped;            // if it is a field and has overlapping
     Dsymbol *aliassym;          // if redone as alias to another symbol
     VarDeclaration *lastVar;    // Linked list of variables for goto-skips-init detection
 
+    int canassign;              // it can be assigned to
     // When interpreting, these point to the value (NULL if value not determinable)
     // The index of this variable on the CTFE stack, -1 if not allocated
     int ctfeAdrOnStack;
@@ -568,6 +569,7 @@ public:
     Statement *frequire;
     Statement *fensure;
     Statement *fbody;
+    LazyBody *lazyBody;                 // source of fbody, if not parsed yet
 
     FuncDeclarations foverrides;        // functions this function overrides
     FuncDeclaration *fdrequire;         // function that does the in contract
@@ -593,21 +595,21 @@ public:
     FuncDeclaration *overnext0;         // next in overload list (only used during IFTI)
     Loc endloc;                         // location of closing curly bracket
     int vtblIndex;                      // for member functions, index into vtbl[]
-    bool naked;                         // true if naked
     ILS inlineStatusStmt;
     ILS inlineStatusExp;
 
     CompiledCtfeFunction *ctfeCode;     // Compiled code for interpreter
     int inlineNest;                     // !=0 if nested inline
+    bool naked;                         // true if naked
     bool isArrayOp;                     // true if array operation
     bool semantic3Errors;               // true if errors in semantic3
                                         // this function's frame ptr
     ForeachStatement *fes;              // if foreach body, this is the foreach
     bool introducing;                   // true if 'introducing' function
+    bool inferRetType;                  // true if return type is to be inferred
     Type *tintro;                       // if !=NULL, then this is the type
                                         // of the 'introducing' function
                                         // this one is overriding
-    bool inferRetType;                  // true if return type is to be inferred
     StorageClass storage_class2;        // storage class for template onemember's
 
     // Things that should really go into Scope
@@ -630,14 +632,13 @@ public:
     int tookAddressOf;                  // set if someone took the address of
                                         // this function
     bool requiresClosure;               // this function needs a closure
+    unsigned flags;
     VarDeclarations closureVars;        // local variables in this function
                                         // which are referenced by nested
                                         // functions
     FuncDeclarations siblingCallers;    // Sibling nested functions which
                                         // called this one
 
-    unsigned flags;
-
     FuncDeclaration(Loc loc, Loc endloc, Identifier *id, StorageClass storage_class, Type *type);
     Dsymbol *syntaxCopy(Dsymbol *);
     void semantic(Scope *sc);
@@ -645,6 +646,7 @@ public:
     void semantic3(Scope *sc);
     bool functionSemantic();
     bool functionSemantic3();
+    void parseLazyBody();
     // called from semantic3
     VarDeclaration *declareThis(Scope *sc, AggregateDeclaration *ad);
     bool equals(RootObject *o);
@@ -33,13 +33,20 @@
 #include "template.h"
 #include "attrib.h"
 #include "enum.h"
+#include "memstats.h"
 
 
 /****************************** Dsymbol ******************************/
 
+void *Dsymbol::operator new(size_t size)
+{
+    return MemStats::allocate(size, NODEdsymbol);
+}
+
 Dsymbol::Dsymbol()
 {
     //printf("Dsymbol::Dsymbol(%p)\n", this);
+    mem.keepRegions();
     this->ident = NULL;
     this->parent = NULL;
     this->csym = NULL;
@@ -57,6 +64,7 @@ Dsymbol::Dsymbol()
 Dsymbol::Dsymbol(Identifier *ident)
 {
     //printf("Dsymbol::Dsymbol(%p, ident)\n", this);
+    mem.keepRegions();
     this->ident = ident;
     this->parent = NULL;
     this->csym = NULL;
@@ -246,12 +254,12 @@ const char *Dsymbol::toPrettyChars(bool QualifyTypes)
 
 Loc& Dsymbol::getLoc()
 {
-    if (!loc.filename)  // avoid bug 5861.
+    if (!loc.filename())  // avoid bug 5861.
     {
         Module *m = getModule();
 
         if (m && m->srcfile)
-            loc.filename = m->srcfile->toChars();
+            loc.setFilename(m->srcfile->toChars());
     }
     return loc;
 }
@@ -852,6 +860,8 @@ ScopeDsymbol::ScopeDsymbol()
     symtab = NULL;
     imports = NULL;
     prots = NULL;
+    importLookups = NULL;
+    imported = false;
 }
 
 ScopeDsymbol::ScopeDsymbol(Identifier *id)
@@ -861,6 +871,8 @@ ScopeDsymbol::ScopeDsymbol(Identifier *id)
     symtab = NULL;
     imports = NULL;
     prots = NULL;
+    importLookups = NULL;
+    imported = false;
 }
 
 Dsymbol *ScopeDsymbol::syntaxCopy(Dsymbol *s)
@@ -897,118 +909,177 @@ Dsymbol *ScopeDsymbol::search(Loc loc, Identifier *ident, int flags)
 
     if (imports)
     {
-        Dsymbol *s = NULL;
-        OverloadSet *a = NULL;
+        Dsymbol *s = searchImports(loc, ident, flags);
+        if (s && !(flags & IgnoreErrors) && s->prot() == PROTprivate && !s->parent->isTemplateMixin())
+        {
+            if (!s->isImport())
+                error(loc, "%s %s is private", s->kind(), s->toPrettyChars());
+        }
+        return s;
+    }
+
+    return s1;
+}
+
+unsigned ScopeDsymbol::lookupEpoch;
+size_t ScopeDsymbol::importSearches;
+size_t ScopeDsymbol::importSearchHits;
+
+struct ImportLookup
+{
+    Dsymbol *s;
+    unsigned epoch;
+};
+
+/*****************************************
+ * Search imports[] for ident, after it wasn't found in symtab.
+ * The outermost search, the one not made while another is in
+ * progress, is remembered in importLookups until lookupEpoch changes,
+ * which it does when a member is added to a scope that is imported
+ * by another, be it a module, a mixin or a namespace, or an import
+ * to any scope. Nested searches may have been cut short by
+ * Module::insearch, so aren't remembered, nor are ones that were
+ * ambiguous or gave errors.
+ */
 
-        // Look in imported modules
-        for (size_t i = 0; i < imports->dim; i++)
+Dsymbol *ScopeDsymbol::searchImports(Loc loc, Identifier *ident, int flags)
+{
+    static int nest;            // searches of imports in progress
+
+    // Only IgnorePrivateMembers changes what is found, if not ambiguous
+    Key key = (Key)((size_t)ident | (flags & IgnorePrivateMembers));
+    if (!nest)
+    {
+        importSearches++;
+        ImportLookup *l = (ImportLookup *)_aaGetRvalue(importLookups, key);
+        if (l && l->epoch == lookupEpoch)
         {
-            // If private import, don't search it
-            if ((flags & IgnorePrivateMembers) && prots[i] == PROTprivate)
-                continue;
+            importSearchHits++;
+            return l->s;
+        }
+    }
+    unsigned epoch = lookupEpoch;
+    unsigned errors = global.errors;
+    bool ambiguous = false;
 
-            Dsymbol *ss = (*imports)[i];
+    Dsymbol *s = NULL;
+    OverloadSet *a = NULL;
 
-            //printf("\tscanning import '%s', prots = %d, isModule = %p, isImport = %p\n", ss->toChars(), prots[i], ss->isModule(), ss->isImport());
-            /* Don't find private members if ss is a module
-             */
-            Dsymbol *s2 = ss->search(loc, ident, ss->isModule() ? IgnorePrivateMembers : IgnoreNone);
-            if (!s)
-                s = s2;
-            else if (s2 && s != s2)
+    nest++;
+
+    // Look in imported modules
+    for (size_t i = 0; i < imports->dim; i++)
+    {
+        // If private import, don't search it
+        if ((flags & IgnorePrivateMembers) && prots[i] == PROTprivate)
+            continue;
+
+        Dsymbol *ss = (*imports)[i];
+
+        //printf("\tscanning import '%s', prots = %d, isModule = %p, isImport = %p\n", ss->toChars(), prots[i], ss->isModule(), ss->isImport());
+        /* Don't find private members if ss is a module
+         */
+        Dsymbol *s2 = ss->search(loc, ident, ss->isModule() ? IgnorePrivateMembers : IgnoreNone);
+        if (!s)
+            s = s2;
+        else if (s2 && s != s2)
+        {
+            if (s->toAlias() == s2->toAlias() ||
+                s->getType() == s2->getType() && s->getType())
+            {
+                /* After following aliases, we found the same
+                 * symbol, so it's not an ambiguity.  But if one
+                 * alias is deprecated or less accessible, prefer
+                 * the other.
+                 */
+                if (s->isDeprecated() ||
+                    s2->prot() > s->prot() && s2->prot() != PROTnone)
+                    s = s2;
+            }
+            else
             {
-                if (s->toAlias() == s2->toAlias() ||
-                    s->getType() == s2->getType() && s->getType())
+                /* Two imports of the same module should be regarded as
+                 * the same.
+                 */
+                Import *i1 = s->isImport();
+                Import *i2 = s2->isImport();
+                if (!(i1 && i2 &&
+                      (i1->mod == i2->mod ||
+                       (!i1->parent->isImport() && !i2->parent->isImport() &&
+                        i1->ident->equals(i2->ident))
+                      )
+                     )
+                   )
                 {
-                    /* After following aliases, we found the same
-                     * symbol, so it's not an ambiguity.  But if one
-                     * alias is deprecated or less accessible, prefer
-                     * the other.
+                    /* Bugzilla 8668:
+                     * Public selective import adds AliasDeclaration in module.
+                     * To make an overload set, resolve aliases in here and
+                     * get actual overload roots which accessible via s and s2.
                      */
-                    if (s->isDeprecated() ||
-                        s2->prot() > s->prot() && s2->prot() != PROTnone)
-                        s = s2;
-                }
-                else
-                {
-                    /* Two imports of the same module should be regarded as
-                     * the same.
+                    s = s->toAlias();
+                    s2 = s2->toAlias();
+
+                    /* If both s2 and s are overloadable (though we only
+                     * need to check s once)
                      */
-                    Import *i1 = s->isImport();
-                    Import *i2 = s2->isImport();
-                    if (!(i1 && i2 &&
-                          (i1->mod == i2->mod ||
-                           (!i1->parent->isImport() && !i2->parent->isImport() &&
-                            i1->ident->equals(i2->ident))
-                          )
-                         )
-                       )
+                    if (s2->isOverloadable() && (a || s->isOverloadable()))
                     {
-                        /* Bugzilla 8668:
-                         * Public selective import adds AliasDeclaration in module.
-                         * To make an overload set, resolve aliases in here and
-                         * get actual overload roots which accessible via s and s2.
-                         */
-                        s = s->toAlias();
-                        s2 = s2->toAlias();
-
-                        /* If both s2 and s are overloadable (though we only
-                         * need to check s once)
+                        if (!a)
+                        {
+                            a = new OverloadSet(s->ident);
+                            a->parent = this;
+                        }
+                        /* Don't add to a[] if s2 is alias of previous sym
                          */
-                        if (s2->isOverloadable() && (a || s->isOverloadable()))
+                        for (size_t j = 0; j < a->a.dim; j++)
                         {
-                            if (!a)
-                            {
-                                a = new OverloadSet(s->ident);
-                                a->parent = this;
-                            }
-                            /* Don't add to a[] if s2 is alias of previous sym
-                             */
-                            for (size_t j = 0; j < a->a.dim; j++)
+                            Dsymbol *s3 = a->a[j];
+                            if (s2->toAlias() == s3->toAlias())
                             {
-                                Dsymbol *s3 = a->a[j];
-                                if (s2->toAlias() == s3->toAlias())
-                                {
-                                    if (s3->isDeprecated() ||
-                                        s2->prot() > s3->prot() && s2->prot() != PROTnone)
-                                        a->a[j] = s2;
-                                    goto Lcontinue;
-                                }
+                                if (s3->isDeprecated() ||
+                                    s2->prot() > s3->prot() && s2->prot() != PROTnone)
+                                    a->a[j] = s2;
+                                goto Lcontinue;
                             }
-                            a->push(s2);
-                        Lcontinue:
-                            continue;
                         }
-                        if (flags & IgnoreAmbiguous)    // if return NULL on ambiguity
-                            return NULL;
-                        if (!(flags & IgnoreErrors))
-                            ScopeDsymbol::multiplyDefined(loc, s, s2);
+                        a->push(s2);
+                    Lcontinue:
+                        continue;
+                    }
+                    ambiguous = true;
+                    if (flags & IgnoreAmbiguous)    // if return NULL on ambiguity
+                    {
+                        s = NULL;
+                        a = NULL;
                         break;
                     }
+                    if (!(flags & IgnoreErrors))
+                        ScopeDsymbol::multiplyDefined(loc, s, s2);
+                    break;
                 }
             }
         }
+    }
 
-        if (s)
-        {
-            /* Build special symbol if we had multiple finds
-             */
-            if (a)
-            {
-                a->push(s);
-                s = a;
-            }
+    nest--;
 
-            if (!(flags & IgnoreErrors) && s->prot() == PROTprivate && !s->parent->isTemplateMixin())
-            {
-                if (!s->isImport())
-                    error(loc, "%s %s is private", s->kind(), s->toPrettyChars());
-            }
-            return s;
-        }
+    /* Build special symbol if we had multiple finds
+     */
+    if (s && a)
+    {
+        a->push(s);
+        s = a;
     }
 
-    return s1;
+    if (!nest && !ambiguous && global.errors == errors)
+    {
+        ImportLookup **pl = (ImportLookup **)_aaGet(&importLookups, key);
+        if (!*pl)
+            *pl = new ImportLookup();
+        (*pl)->s = s;
+        (*pl)->epoch = epoch;
+    }
+    return s;
 }
 
 void ScopeDsymbol::importScope(Dsymbol *s, PROT protection)
@@ -1028,7 +1099,10 @@ void ScopeDsymbol::importScope(Dsymbol *s, PROT protection)
                 if (ss == s)                    // if already imported
                 {
                     if (protection > prots[i])
+                    {
                         prots[i] = protection;  // upgrade access
+                        lookupEpoch++;
+                    }
                     return;
                 }
             }
@@ -1036,6 +1110,9 @@ void ScopeDsymbol::importScope(Dsymbol *s, PROT protection)
         imports->push(s);
         prots = (PROT *)mem.realloc(prots, imports->dim * sizeof(prots[0]));
         prots[imports->dim - 1] = protection;
+        if (ScopeDsymbol *sds = s->isScopeDsymbol())
+            sds->imported = true;
+        lookupEpoch++;
     }
 }
 
@@ -1051,7 +1128,7 @@ void ScopeDsymbol::multiplyDefined(Loc loc, Dsymbol *s1, Dsymbol *s2)
     printf("s1 = %p, '%s' kind = '%s', parent = %s\n", s1, s1->toChars(), s1->kind(), s1->parent ? s1->parent->toChars() : "");
     printf("s2 = %p, '%s' kind = '%s', parent = %s\n", s2, s2->toChars(), s2->kind(), s2->parent ? s2->parent->toChars() : "");
 #endif
-    if (loc.filename)
+    if (loc.filename())
     {   ::error(loc, "%s at %s conflicts with %s at %s",
             s1->toPrettyChars(),
             s1->locToChars(),
@@ -1074,6 +1151,8 @@ const char *ScopeDsymbol::kind()
 
 Dsymbol *ScopeDsymbol::symtabInsert(Dsymbol *s)
 {
+    if (imported)
+        lookupEpoch++;          // it may be found through an import
     return symtab->insert(s);
 }
 
@@ -147,6 +147,7 @@ public:
     UserAttributeDeclaration *userAttribDecl;   // user defined attributes
     UnitTestDeclaration *ddocUnittest; // !=NULL means there's a ddoc unittest associated with this symbol (only use this with ddoc)
 
+    static void *operator new(size_t size);
     Dsymbol();
     Dsymbol(Identifier *);
     static Dsymbol *create(Identifier *);
@@ -285,12 +286,21 @@ public:
 private:
     Dsymbols *imports;          // imported Dsymbol's
     PROT *prots;                // array of PROT, one for each import
+    AA *importLookups;          // results of searchImports(), see there
+    bool imported;              // in the imports[] of some scope
 
 public:
+    static unsigned lookupEpoch;        // changes when a search of imports could
+    static size_t importSearches;       // outermost searches of imports
+    static size_t importSearchHits;     // of those, the ones found in importLookups
+
     ScopeDsymbol();
     ScopeDsymbol(Identifier *id);
     Dsymbol *syntaxCopy(Dsymbol *s);
     Dsymbol *search(Loc loc, Identifier *ident, int flags = IgnoreNone);
+private:
+    Dsymbol *searchImports(Loc loc, Identifier *ident, int flags);
+public:
     void importScope(Dsymbol *s, PROT protection);
     bool isforwardRef();
     static void multiplyDefined(Loc loc, Dsymbol *s1, Dsymbol *s2);
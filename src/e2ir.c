@@ -59,7 +59,7 @@ Symbol *toSymbol(Dsymbol *s);
 int callSideEffectLevel(FuncDeclaration *f);
 int callSideEffectLevel(Type *t);
 
-#define el_setLoc(e,loc)        ((e)->Esrcpos.Sfilename = (char *)(loc).filename, \
+#define el_setLoc(e,loc)        ((e)->Esrcpos.Sfilename = (char *)(loc).filename(), \
                                  (e)->Esrcpos.Slinnum = (loc).linnum, \
                                  (e)->Esrcpos.Scharnum = (loc).charnum)
 
@@ -1271,7 +1271,8 @@ elem *toElem(Expression *e, IRState *irs)
                         st->si &&
                         st->len == se->len &&
                         st->sz == se->sz &&
-                        memcmp(st->string, se->string, se->sz * se->len) == 0)
+                        (st->string == se->string ||    // literals share their data
+                         memcmp(st->string, se->string, se->sz * se->len) == 0))
                     {
                         //printf("use cached value\n");
                         si = st->si;    // use cached value
@@ -1786,7 +1787,7 @@ elem *toElem(Expression *e, IRState *irs)
                  * to a #line directive.
                  */
                 elem *ea;
-                if (ae->loc.filename && (ae->msg || strcmp(ae->loc.filename, mname) != 0))
+                if (ae->loc.filename() && (ae->msg || strcmp(ae->loc.filename(), mname) != 0))
                 {
                     /* Cache values.
                      */
@@ -1794,10 +1795,10 @@ elem *toElem(Expression *e, IRState *irs)
                     //static char *assertexp_name = NULL;
                     //static Module *assertexp_mn = NULL;
 
-                    if (!assertexp_sfilename || strcmp(ae->loc.filename, assertexp_name) != 0 || assertexp_mn != m)
+                    if (!assertexp_sfilename || strcmp(ae->loc.filename(), assertexp_name) != 0 || assertexp_mn != m)
                     {
 
-                        const char *id = ae->loc.filename;
+                        const char *id = ae->loc.filename();
                         int len = strlen(id);
                         dt_t *dt = NULL;
                         dtsize_t(&dt, len);
@@ -0,0 +1,183 @@
+static elem *(*elxxx[OPMAX]) (elem *, goal_t) = 
+	{
+	elerr,
+	eladd,
+	elmin,
+	elmul,
+	eldiv,
+	elmod,
+	elshr,
+	elshl,
+	elbitwise,
+	elxor,
+	elor,
+	elshr,
+	elnot,
+	elbool,
+	elcom,
+	elcond,
+	elcomma,
+	eloror,
+	elandand,
+	elbit,
+	elind,
+	eladdr,
+	elneg,
+	elzot,
+	elzot,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	elzot,
+	elzot,
+	elzot,
+	elzot,
+	elstrcpy,
+	elzot,
+	elstrcmp,
+	elmemxxx,
+	elmemxxx,
+	elmemxxx,
+	elzot,
+	elremquo,
+	elzot,
+	elzot,
+	elzot,
+	elzot,
+	elzot,
+	elzot,
+	evalu8,
+	elshl,
+	elshl,
+	elzot,
+	elstruct,
+	elnegass,
+	elpost,
+	elpost,
+	eleq,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elopass,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	elcmp,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	elu64_d,
+	evalu8,
+	evalu8,
+	evalu8,
+	evalu8,
+	ellngsht,
+	elbyteint,
+	elbyteint,
+	ellngsht,
+	el32_64,
+	el32_64,
+	el64_32,
+	evalu8,
+	evalu8,
+	el64_32,
+	evalu8,
+	evalu8,
+	evalu8,
+	elc_r,
+	elc_i,
+	elmsw,
+	elparam,
+	elcall,
+	elcall,
+	elcall,
+	elcall,
+	elzot,
+	elzot,
+	elzot,
+	elstruct,
+	elerr,
+	elzot,
+	elerr,
+	elerr,
+	elzot,
+	elzot,
+	elstring,
+	elerr,
+	elzot,
+	elinfo,
+	elzot,
+	elinfo,
+	elinfo,
+	elinfo,
+	elzot,
+	elddtor,
+	elpair,
+	elpair,
+	elzot,
+	elzot,
+	elzot,
+	elzot,
+	elarray,
+	elarraylength,
+	elfield,
+	elnewarray,
+	elmultinewarray,
+	elinstanceof,
+	elfinalinstanceof,
+	elcheckcast,
+	elhstring,
+	elnullcheck,
+	elzot,
+	elzot,
+	elerr,
+	elerr,
+	elerr,
+	elerr,
+	elerr,
+	elzot,
+	elzot,
+	elzot,
+	elzot
+	};
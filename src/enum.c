@@ -127,6 +127,7 @@ void EnumDeclaration::semantic(Scope *sc)
         ::error(loc, "circular reference to enum base type %s", memtype->toChars());
         errors = true;
         semanticRun = PASSsemanticdone;
+        Module::resumeDeferredSemantic(this);
         return;
     }
     semanticRun = PASSsemantic;
@@ -175,7 +176,7 @@ void EnumDeclaration::semantic(Scope *sc)
                 // memtype is forward referenced, so try again later
                 scope = scx ? scx : sc->copy();
                 scope->setNoFree();
-                scope->module->addDeferredSemantic(this);
+                scope->module->addDeferredSemantic(this, sym);
                 Module::dprogress = dprogress_save;
                 //printf("\tdeferring %s\n", toChars());
                 semanticRun = PASSinit;
@@ -199,6 +200,7 @@ void EnumDeclaration::semantic(Scope *sc)
                 }
             }
             semanticRun = PASSsemanticdone;
+            Module::resumeDeferredSemantic(this);
             return;
         }
     }
@@ -206,12 +208,16 @@ void EnumDeclaration::semantic(Scope *sc)
     semanticRun = PASSsemanticdone;
 
     if (!members)               // enum ident : memtype;
+    {
+        Module::resumeDeferredSemantic(this);
         return;
+    }
 
     if (members->dim == 0)
     {
         error("enum %s must have at least one member", toChars());
         errors = true;
+        Module::resumeDeferredSemantic(this);
         return;
     }
 
@@ -282,6 +288,7 @@ void EnumDeclaration::semantic(Scope *sc)
             em->semantic(em->scope);
     }
     //printf("defaultval = %lld\n", defaultval);
+    Module::resumeDeferredSemantic(this);
 
     //if (defaultval) printf("defaultval: %s %s\n", defaultval->toChars(), defaultval->type->toChars());
     //members->print();
@@ -40,6 +40,7 @@
 #include "doc.h"
 #include "aav.h"
 #include "nspace.h"
+#include "memstats.h"
 
 bool isArrayOpValid(Expression *e);
 bool isNonAssignmentArrayOp(Expression *e);
@@ -1842,6 +1843,11 @@ void argExpTypesToCBuffer(OutBuffer *buf, Expressions *arguments, HdrGenState *h
 
 /******************************** Expression **************************/
 
+void *Expression::operator new(size_t size)
+{
+    return MemStats::allocate(size, NODEexpression);
+}
+
 Expression::Expression(Loc loc, TOK op, int size)
 {
     //printf("Expression::Expression(op = %d) this = %p\n", op, this);
@@ -1892,7 +1898,10 @@ Expression *Expression::copy()
     }
     e = (Expression *)mem.malloc(size);
     //printf("Expression::copy(op = %d) e = %p\n", op, e);
-    return (Expression *)memcpy((void*)e, (void*)this, size);
+    memcpy((void*)e, (void*)this, size);
+    if (MemStats::enabled)
+        MemStats::record(e, size, NODEexpression);
+    return e;
 }
 
 /**************************
@@ -2101,7 +2110,7 @@ Expression *Expression::toLvalue(Scope *sc, Expression *e)
 {
     if (!e)
         e = this;
-    else if (!loc.filename)
+    else if (!loc.filename())
         loc = e->loc;
 
     if (e->op == TOKtype)
@@ -2734,7 +2743,7 @@ Expression *IntegerExp::toLvalue(Scope *sc, Expression *e)
 {
     if (!e)
         e = this;
-    else if (!loc.filename)
+    else if (!loc.filename())
         loc = e->loc;
     e->error("constant %s is not an lvalue", e->toChars());
     return new ErrorExp();
@@ -3691,7 +3700,11 @@ Expression *StringExp::semantic(Scope *sc)
     switch (postfix)
     {
         case 'd':
-            for (u = 0; u < len;)
+            // Convert the valid prefix in bulk, then the rest one by one
+            buffer.reserve(len * 4);
+            u = utf_toUTF32((utf8_t *)string, len, (utf32_t *)buffer.data, &newlen);
+            buffer.offset = newlen * 4;
+            while (u < len)
             {
                 p = utf_decodeChar((utf8_t *)string, len, &u, &c);
                 if (p)
@@ -3715,7 +3728,10 @@ Expression *StringExp::semantic(Scope *sc)
             break;
 
         case 'w':
-            for (u = 0; u < len;)
+            buffer.reserve(len * 2);
+            u = utf_toUTF16((utf8_t *)string, len, (utf16_t *)buffer.data, &newlen);
+            buffer.offset = newlen * 2;
+            while (u < len)
             {
                 p = utf_decodeChar((utf8_t *)string, len, &u, &c);
                 if (p)
@@ -3767,7 +3783,8 @@ size_t StringExp::length()
     switch (sz)
     {
         case 1:
-            for (size_t u = 0; u < len;)
+            result = utf_asciiLength((utf8_t *)string, len);
+            for (size_t u = result; u < len;)
             {
                 p = utf_decodeChar((utf8_t *)string, len, &u, &c);
                 if (p)
@@ -6981,7 +6998,7 @@ Expression *FileExp::semantic(Scope *sc)
     }
 
     {   File f(name);
-        if (f.read())
+        if (f.mmread())
         {   error("cannot read file %s", f.toChars());
             goto Lerror;
         }
@@ -13801,7 +13818,7 @@ Expression *FileInitExp::semantic(Scope *sc)
 Expression *FileInitExp::resolveLoc(Loc loc, Scope *sc)
 {
     //printf("FileInitExp::resolve() %s\n", toChars());
-    const char *s = loc.filename ? loc.filename : sc->module->ident->toChars();
+    const char *s = loc.filename() ? loc.filename() : sc->module->ident->toChars();
     Expression *e = new StringExp(loc, (char *)s);
     e = e->semantic(sc);
     e = e->castTo(sc, type);
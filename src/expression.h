@@ -148,6 +148,7 @@ public:
     unsigned char size;         // # of bytes in Expression so we can copy() it
     unsigned char parens;       // if this is a parenthesized expression
 
+    static void *operator new(size_t size);
     Expression(Loc loc, TOK op, int size);
     static void init();
     Expression *copy();
@@ -30,6 +30,7 @@
 #include "parse.h"
 #include "rmem.h"
 #include "visitor.h"
+#include "timetrace.h"
 
 void functionToBufferWithIdent(TypeFunction *t, OutBuffer *buf, const char *ident);
 void genCmain(Scope *sc);
@@ -301,6 +302,7 @@ FuncDeclaration::FuncDeclaration(Loc loc, Loc endloc, Identifier *id, StorageCla
     scout = NULL;
     fensure = NULL;
     fbody = NULL;
+    lazyBody = NULL;
     localsymtab = NULL;
     vthis = NULL;
     v_arguments = NULL;
@@ -350,6 +352,7 @@ Dsymbol *FuncDeclaration::syntaxCopy(Dsymbol *s)
         f = (FuncDeclaration *)s;
     else
         f = new FuncDeclaration(loc, endloc, ident, storage_class, type->syntaxCopy());
+    parseLazyBody();
     f->outId = outId;
     f->frequire = frequire ? frequire->syntaxCopy() : NULL;
     f->fensure  = fensure  ? fensure->syntaxCopy()  : NULL;
@@ -1207,6 +1210,8 @@ void FuncDeclaration::semantic3(Scope *sc)
         return;
     semanticRun = PASSsemantic3;
     semantic3Errors = false;
+    TimeTraceScope tt("function", "semantic3", this);
+    parseLazyBody();
 
     if (!type || type->ty != Tfunction)
         return;
@@ -2160,6 +2165,29 @@ void FuncDeclaration::semantic3(Scope *sc)
     //fflush(stdout);
 }
 
+/****************************************************
+ * Parse the body the parser skipped, if it did, now that it is needed.
+ * The statements go into the stand-in fbody, wherever that is now.
+ */
+
+void FuncDeclaration::parseLazyBody()
+{
+    if (!lazyBody)
+        return;
+    LazyBody *lb = lazyBody;
+    lazyBody = NULL;
+
+    // Syntax errors are reported whoever needs the body, as when parsing the module
+    unsigned oldgag = global.gag;
+    global.gag = 0;
+    lb->fbody->statements = Parser::parseLazyBody(lb)->statements;
+    global.gag = oldgag;
+
+    // The source isn't needed once the last of the module's bodies is parsed
+    if (--lb->mod->nlazyBodies == 0)
+        lb->mod->srcfile->freebuffer();
+}
+
 bool FuncDeclaration::functionSemantic()
 {
     if (!scope)
@@ -2330,6 +2358,7 @@ bool FuncDeclaration::equals(RootObject *o)
 
 void FuncDeclaration::bodyToCBuffer(OutBuffer *buf, HdrGenState *hgs)
 {
+    parseLazyBody();
     if (fbody && (!hgs->hdrgen || global.params.useInline || hgs->autoMember || hgs->tpltMember))
     {
         int savetlpt = hgs->tpltMember;
@@ -4532,6 +4561,7 @@ Dsymbol *CtorDeclaration::syntaxCopy(Dsymbol *s)
 {
     CtorDeclaration *f = new CtorDeclaration(loc, endloc, storage_class, type->syntaxCopy());
 
+    parseLazyBody();
     f->outId = outId;
     f->frequire = frequire ? frequire->syntaxCopy() : NULL;
     f->fensure  = fensure  ? fensure->syntaxCopy()  : NULL;
@@ -28,6 +28,7 @@
 #include "template.h"
 #include "lib.h"
 #include "target.h"
+#include "timetrace.h"
 
 #include "rmem.h"
 #include "cc.h"
@@ -301,6 +302,7 @@ void Module::genobjfile(bool multiobj)
     //EEcontext *ee = env->getEEcontext();
 
     //printf("Module::genobjfile(multiobj = %d) %s\n", multiobj, toChars());
+    TimeTraceScope tt("module", "codegen", this);
 
     if (ident == Id::entrypoint)
     {
@@ -782,6 +784,7 @@ void FuncDeclaration::toObjFile(bool multiobj)
     UnitTestDeclaration *ud = func->isUnitTestDeclaration();
     if (ud && !global.params.useUnitTests)
         return;
+    TimeTraceScope tt("function", "codegen", this);
 
     if (multiobj && !isStaticDtorDeclaration() && !isStaticCtorDeclaration())
     {
@@ -0,0 +1,569 @@
+// File generated by idgen.c
+#include "id.h"
+#include "identifier.h"
+#include "lexer.h"
+Identifier *Id::IUnknown;
+Identifier *Id::Object;
+Identifier *Id::object;
+Identifier *Id::max;
+Identifier *Id::min;
+Identifier *Id::This;
+Identifier *Id::super;
+Identifier *Id::ctor;
+Identifier *Id::dtor;
+Identifier *Id::cpctor;
+Identifier *Id::_postblit;
+Identifier *Id::classInvariant;
+Identifier *Id::unitTest;
+Identifier *Id::require;
+Identifier *Id::ensure;
+Identifier *Id::init;
+Identifier *Id::__sizeof;
+Identifier *Id::__xalignof;
+Identifier *Id::mangleof;
+Identifier *Id::stringof;
+Identifier *Id::tupleof;
+Identifier *Id::length;
+Identifier *Id::remove;
+Identifier *Id::ptr;
+Identifier *Id::array;
+Identifier *Id::funcptr;
+Identifier *Id::dollar;
+Identifier *Id::ctfe;
+Identifier *Id::offset;
+Identifier *Id::offsetof;
+Identifier *Id::ModuleInfo;
+Identifier *Id::ClassInfo;
+Identifier *Id::classinfo;
+Identifier *Id::typeinfo;
+Identifier *Id::outer;
+Identifier *Id::Exception;
+Identifier *Id::RTInfo;
+Identifier *Id::Throwable;
+Identifier *Id::Error;
+Identifier *Id::withSym;
+Identifier *Id::result;
+Identifier *Id::returnLabel;
+Identifier *Id::line;
+Identifier *Id::empty;
+Identifier *Id::p;
+Identifier *Id::q;
+Identifier *Id::__vptr;
+Identifier *Id::__monitor;
+Identifier *Id::gate;
+Identifier *Id::TypeInfo;
+Identifier *Id::TypeInfo_Class;
+Identifier *Id::TypeInfo_Interface;
+Identifier *Id::TypeInfo_Struct;
+Identifier *Id::TypeInfo_Enum;
+Identifier *Id::TypeInfo_Typedef;
+Identifier *Id::TypeInfo_Pointer;
+Identifier *Id::TypeInfo_Vector;
+Identifier *Id::TypeInfo_Array;
+Identifier *Id::TypeInfo_StaticArray;
+Identifier *Id::TypeInfo_AssociativeArray;
+Identifier *Id::TypeInfo_Function;
+Identifier *Id::TypeInfo_Delegate;
+Identifier *Id::TypeInfo_Tuple;
+Identifier *Id::TypeInfo_Const;
+Identifier *Id::TypeInfo_Invariant;
+Identifier *Id::TypeInfo_Shared;
+Identifier *Id::TypeInfo_Wild;
+Identifier *Id::elements;
+Identifier *Id::_arguments_typeinfo;
+Identifier *Id::_arguments;
+Identifier *Id::_argptr;
+Identifier *Id::destroy;
+Identifier *Id::postblit;
+Identifier *Id::xopEquals;
+Identifier *Id::xopCmp;
+Identifier *Id::xtoHash;
+Identifier *Id::LINE;
+Identifier *Id::FILE;
+Identifier *Id::MODULE;
+Identifier *Id::FUNCTION;
+Identifier *Id::PRETTY_FUNCTION;
+Identifier *Id::DATE;
+Identifier *Id::TIME;
+Identifier *Id::TIMESTAMP;
+Identifier *Id::VENDOR;
+Identifier *Id::VERSIONX;
+Identifier *Id::EOFX;
+Identifier *Id::nan;
+Identifier *Id::infinity;
+Identifier *Id::dig;
+Identifier *Id::epsilon;
+Identifier *Id::mant_dig;
+Identifier *Id::max_10_exp;
+Identifier *Id::max_exp;
+Identifier *Id::min_10_exp;
+Identifier *Id::min_exp;
+Identifier *Id::min_normal;
+Identifier *Id::re;
+Identifier *Id::im;
+Identifier *Id::C;
+Identifier *Id::D;
+Identifier *Id::Windows;
+Identifier *Id::Pascal;
+Identifier *Id::System;
+Identifier *Id::exit;
+Identifier *Id::success;
+Identifier *Id::failure;
+Identifier *Id::keys;
+Identifier *Id::values;
+Identifier *Id::rehash;
+Identifier *Id::sort;
+Identifier *Id::reverse;
+Identifier *Id::property;
+Identifier *Id::nogc;
+Identifier *Id::safe;
+Identifier *Id::trusted;
+Identifier *Id::system;
+Identifier *Id::disable;
+Identifier *Id::___out;
+Identifier *Id::___in;
+Identifier *Id::__int;
+Identifier *Id::__dollar;
+Identifier *Id::__LOCAL_SIZE;
+Identifier *Id::uadd;
+Identifier *Id::neg;
+Identifier *Id::com;
+Identifier *Id::add;
+Identifier *Id::add_r;
+Identifier *Id::sub;
+Identifier *Id::sub_r;
+Identifier *Id::mul;
+Identifier *Id::mul_r;
+Identifier *Id::div;
+Identifier *Id::div_r;
+Identifier *Id::mod;
+Identifier *Id::mod_r;
+Identifier *Id::eq;
+Identifier *Id::cmp;
+Identifier *Id::iand;
+Identifier *Id::iand_r;
+Identifier *Id::ior;
+Identifier *Id::ior_r;
+Identifier *Id::ixor;
+Identifier *Id::ixor_r;
+Identifier *Id::shl;
+Identifier *Id::shl_r;
+Identifier *Id::shr;
+Identifier *Id::shr_r;
+Identifier *Id::ushr;
+Identifier *Id::ushr_r;
+Identifier *Id::cat;
+Identifier *Id::cat_r;
+Identifier *Id::assign;
+Identifier *Id::addass;
+Identifier *Id::subass;
+Identifier *Id::mulass;
+Identifier *Id::divass;
+Identifier *Id::modass;
+Identifier *Id::andass;
+Identifier *Id::orass;
+Identifier *Id::xorass;
+Identifier *Id::shlass;
+Identifier *Id::shrass;
+Identifier *Id::ushrass;
+Identifier *Id::catass;
+Identifier *Id::postinc;
+Identifier *Id::postdec;
+Identifier *Id::index;
+Identifier *Id::indexass;
+Identifier *Id::slice;
+Identifier *Id::sliceass;
+Identifier *Id::call;
+Identifier *Id::cast;
+Identifier *Id::opIn;
+Identifier *Id::opIn_r;
+Identifier *Id::opStar;
+Identifier *Id::opDot;
+Identifier *Id::opDispatch;
+Identifier *Id::opDollar;
+Identifier *Id::opUnary;
+Identifier *Id::opIndexUnary;
+Identifier *Id::opSliceUnary;
+Identifier *Id::opBinary;
+Identifier *Id::opBinaryRight;
+Identifier *Id::opOpAssign;
+Identifier *Id::opIndexOpAssign;
+Identifier *Id::opSliceOpAssign;
+Identifier *Id::pow;
+Identifier *Id::pow_r;
+Identifier *Id::powass;
+Identifier *Id::classNew;
+Identifier *Id::classDelete;
+Identifier *Id::apply;
+Identifier *Id::applyReverse;
+Identifier *Id::Fempty;
+Identifier *Id::Ffront;
+Identifier *Id::Fback;
+Identifier *Id::FpopFront;
+Identifier *Id::FpopBack;
+Identifier *Id::adReverse;
+Identifier *Id::aaLen;
+Identifier *Id::aaKeys;
+Identifier *Id::aaValues;
+Identifier *Id::aaRehash;
+Identifier *Id::monitorenter;
+Identifier *Id::monitorexit;
+Identifier *Id::criticalenter;
+Identifier *Id::criticalexit;
+Identifier *Id::_ArrayEq;
+Identifier *Id::lib;
+Identifier *Id::msg;
+Identifier *Id::startaddress;
+Identifier *Id::mangle;
+Identifier *Id::tohash;
+Identifier *Id::tostring;
+Identifier *Id::getmembers;
+Identifier *Id::main;
+Identifier *Id::WinMain;
+Identifier *Id::DllMain;
+Identifier *Id::tls_get_addr;
+Identifier *Id::entrypoint;
+Identifier *Id::va_argsave_t;
+Identifier *Id::va_argsave;
+Identifier *Id::std;
+Identifier *Id::core;
+Identifier *Id::math;
+Identifier *Id::sin;
+Identifier *Id::cos;
+Identifier *Id::tan;
+Identifier *Id::_sqrt;
+Identifier *Id::_pow;
+Identifier *Id::atan2;
+Identifier *Id::rndtol;
+Identifier *Id::expm1;
+Identifier *Id::exp2;
+Identifier *Id::yl2x;
+Identifier *Id::yl2xp1;
+Identifier *Id::fabs;
+Identifier *Id::bitop;
+Identifier *Id::bsf;
+Identifier *Id::bsr;
+Identifier *Id::bswap;
+Identifier *Id::isAbstractClass;
+Identifier *Id::isArithmetic;
+Identifier *Id::isAssociativeArray;
+Identifier *Id::isFinalClass;
+Identifier *Id::isPOD;
+Identifier *Id::isNested;
+Identifier *Id::isFloating;
+Identifier *Id::isIntegral;
+Identifier *Id::isScalar;
+Identifier *Id::isStaticArray;
+Identifier *Id::isUnsigned;
+Identifier *Id::isVirtualFunction;
+Identifier *Id::isVirtualMethod;
+Identifier *Id::isAbstractFunction;
+Identifier *Id::isFinalFunction;
+Identifier *Id::isOverrideFunction;
+Identifier *Id::isStaticFunction;
+Identifier *Id::isRef;
+Identifier *Id::isOut;
+Identifier *Id::isLazy;
+Identifier *Id::hasMember;
+Identifier *Id::identifier;
+Identifier *Id::getProtection;
+Identifier *Id::parent;
+Identifier *Id::getMember;
+Identifier *Id::getOverloads;
+Identifier *Id::getVirtualFunctions;
+Identifier *Id::getVirtualMethods;
+Identifier *Id::classInstanceSize;
+Identifier *Id::allMembers;
+Identifier *Id::derivedMembers;
+Identifier *Id::isSame;
+Identifier *Id::compiles;
+Identifier *Id::parameters;
+Identifier *Id::getAliasThis;
+Identifier *Id::getAttributes;
+Identifier *Id::getFunctionAttributes;
+Identifier *Id::getUnitTests;
+Identifier *Id::getVirtualIndex;
+void Id::initialize()
+{
+    IUnknown = Lexer::idPool("IUnknown");
+    Object = Lexer::idPool("Object");
+    object = Lexer::idPool("object");
+    max = Lexer::idPool("max");
+    min = Lexer::idPool("min");
+    This = Lexer::idPool("this");
+    super = Lexer::idPool("super");
+    ctor = Lexer::idPool("__ctor");
+    dtor = Lexer::idPool("__dtor");
+    cpctor = Lexer::idPool("__cpctor");
+    _postblit = Lexer::idPool("__postblit");
+    classInvariant = Lexer::idPool("__invariant");
+    unitTest = Lexer::idPool("__unitTest");
+    require = Lexer::idPool("__require");
+    ensure = Lexer::idPool("__ensure");
+    init = Lexer::idPool("init");
+    __sizeof = Lexer::idPool("sizeof");
+    __xalignof = Lexer::idPool("alignof");
+    mangleof = Lexer::idPool("mangleof");
+    stringof = Lexer::idPool("stringof");
+    tupleof = Lexer::idPool("tupleof");
+    length = Lexer::idPool("length");
+    remove = Lexer::idPool("remove");
+    ptr = Lexer::idPool("ptr");
+    array = Lexer::idPool("array");
+    funcptr = Lexer::idPool("funcptr");
+    dollar = Lexer::idPool("__dollar");
+    ctfe = Lexer::idPool("__ctfe");
+    offset = Lexer::idPool("offset");
+    offsetof = Lexer::idPool("offsetof");
+    ModuleInfo = Lexer::idPool("ModuleInfo");
+    ClassInfo = Lexer::idPool("ClassInfo");
+    classinfo = Lexer::idPool("classinfo");
+    typeinfo = Lexer::idPool("typeinfo");
+    outer = Lexer::idPool("outer");
+    Exception = Lexer::idPool("Exception");
+    RTInfo = Lexer::idPool("RTInfo");
+    Throwable = Lexer::idPool("Throwable");
+    Error = Lexer::idPool("Error");
+    withSym = Lexer::idPool("__withSym");
+    result = Lexer::idPool("__result");
+    returnLabel = Lexer::idPool("__returnLabel");
+    line = Lexer::idPool("line");
+    empty = Lexer::idPool("");
+    p = Lexer::idPool("p");
+    q = Lexer::idPool("q");
+    __vptr = Lexer::idPool("__vptr");
+    __monitor = Lexer::idPool("__monitor");
+    gate = Lexer::idPool("__gate");
+    TypeInfo = Lexer::idPool("TypeInfo");
+    TypeInfo_Class = Lexer::idPool("TypeInfo_Class");
+    TypeInfo_Interface = Lexer::idPool("TypeInfo_Interface");
+    TypeInfo_Struct = Lexer::idPool("TypeInfo_Struct");
+    TypeInfo_Enum = Lexer::idPool("TypeInfo_Enum");
+    TypeInfo_Typedef = Lexer::idPool("TypeInfo_Typedef");
+    TypeInfo_Pointer = Lexer::idPool("TypeInfo_Pointer");
+    TypeInfo_Vector = Lexer::idPool("TypeInfo_Vector");
+    TypeInfo_Array = Lexer::idPool("TypeInfo_Array");
+    TypeInfo_StaticArray = Lexer::idPool("TypeInfo_StaticArray");
+    TypeInfo_AssociativeArray = Lexer::idPool("TypeInfo_AssociativeArray");
+    TypeInfo_Function = Lexer::idPool("TypeInfo_Function");
+    TypeInfo_Delegate = Lexer::idPool("TypeInfo_Delegate");
+    TypeInfo_Tuple = Lexer::idPool("TypeInfo_Tuple");
+    TypeInfo_Const = Lexer::idPool("TypeInfo_Const");
+    TypeInfo_Invariant = Lexer::idPool("TypeInfo_Invariant");
+    TypeInfo_Shared = Lexer::idPool("TypeInfo_Shared");
+    TypeInfo_Wild = Lexer::idPool("TypeInfo_Inout");
+    elements = Lexer::idPool("elements");
+    _arguments_typeinfo = Lexer::idPool("_arguments_typeinfo");
+    _arguments = Lexer::idPool("_arguments");
+    _argptr = Lexer::idPool("_argptr");
+    destroy = Lexer::idPool("destroy");
+    postblit = Lexer::idPool("postblit");
+    xopEquals = Lexer::idPool("__xopEquals");
+    xopCmp = Lexer::idPool("__xopCmp");
+    xtoHash = Lexer::idPool("__xtoHash");
+    LINE = Lexer::idPool("__LINE__");
+    FILE = Lexer::idPool("__FILE__");
+    MODULE = Lexer::idPool("__MODULE__");
+    FUNCTION = Lexer::idPool("__FUNCTION__");
+    PRETTY_FUNCTION = Lexer::idPool("__PRETTY_FUNCTION__");
+    DATE = Lexer::idPool("__DATE__");
+    TIME = Lexer::idPool("__TIME__");
+    TIMESTAMP = Lexer::idPool("__TIMESTAMP__");
+    VENDOR = Lexer::idPool("__VENDOR__");
+    VERSIONX = Lexer::idPool("__VERSION__");
+    EOFX = Lexer::idPool("__EOF__");
+    nan = Lexer::idPool("nan");
+    infinity = Lexer::idPool("infinity");
+    dig = Lexer::idPool("dig");
+    epsilon = Lexer::idPool("epsilon");
+    mant_dig = Lexer::idPool("mant_dig");
+    max_10_exp = Lexer::idPool("max_10_exp");
+    max_exp = Lexer::idPool("max_exp");
+    min_10_exp = Lexer::idPool("min_10_exp");
+    min_exp = Lexer::idPool("min_exp");
+    min_normal = Lexer::idPool("min_normal");
+    re = Lexer::idPool("re");
+    im = Lexer::idPool("im");
+    C = Lexer::idPool("C");
+    D = Lexer::idPool("D");
+    Windows = Lexer::idPool("Windows");
+    Pascal = Lexer::idPool("Pascal");
+    System = Lexer::idPool("System");
+    exit = Lexer::idPool("exit");
+    success = Lexer::idPool("success");
+    failure = Lexer::idPool("failure");
+    keys = Lexer::idPool("keys");
+    values = Lexer::idPool("values");
+    rehash = Lexer::idPool("rehash");
+    sort = Lexer::idPool("sort");
+    reverse = Lexer::idPool("reverse");
+    property = Lexer::idPool("property");
+    nogc = Lexer::idPool("nogc");
+    safe = Lexer::idPool("safe");
+    trusted = Lexer::idPool("trusted");
+    system = Lexer::idPool("system");
+    disable = Lexer::idPool("disable");
+    ___out = Lexer::idPool("out");
+    ___in = Lexer::idPool("in");
+    __int = Lexer::idPool("int");
+    __dollar = Lexer::idPool("$");
+    __LOCAL_SIZE = Lexer::idPool("__LOCAL_SIZE");
+    uadd = Lexer::idPool("opPos");
+    neg = Lexer::idPool("opNeg");
+    com = Lexer::idPool("opCom");
+    add = Lexer::idPool("opAdd");
+    add_r = Lexer::idPool("opAdd_r");
+    sub = Lexer::idPool("opSub");
+    sub_r = Lexer::idPool("opSub_r");
+    mul = Lexer::idPool("opMul");
+    mul_r = Lexer::idPool("opMul_r");
+    div = Lexer::idPool("opDiv");
+    div_r = Lexer::idPool("opDiv_r");
+    mod = Lexer::idPool("opMod");
+    mod_r = Lexer::idPool("opMod_r");
+    eq = Lexer::idPool("opEquals");
+    cmp = Lexer::idPool("opCmp");
+    iand = Lexer::idPool("opAnd");
+    iand_r = Lexer::idPool("opAnd_r");
+    ior = Lexer::idPool("opOr");
+    ior_r = Lexer::idPool("opOr_r");
+    ixor = Lexer::idPool("opXor");
+    ixor_r = Lexer::idPool("opXor_r");
+    shl = Lexer::idPool("opShl");
+    shl_r = Lexer::idPool("opShl_r");
+    shr = Lexer::idPool("opShr");
+    shr_r = Lexer::idPool("opShr_r");
+    ushr = Lexer::idPool("opUShr");
+    ushr_r = Lexer::idPool("opUShr_r");
+    cat = Lexer::idPool("opCat");
+    cat_r = Lexer::idPool("opCat_r");
+    assign = Lexer::idPool("opAssign");
+    addass = Lexer::idPool("opAddAssign");
+    subass = Lexer::idPool("opSubAssign");
+    mulass = Lexer::idPool("opMulAssign");
+    divass = Lexer::idPool("opDivAssign");
+    modass = Lexer::idPool("opModAssign");
+    andass = Lexer::idPool("opAndAssign");
+    orass = Lexer::idPool("opOrAssign");
+    xorass = Lexer::idPool("opXorAssign");
+    shlass = Lexer::idPool("opShlAssign");
+    shrass = Lexer::idPool("opShrAssign");
+    ushrass = Lexer::idPool("opUShrAssign");
+    catass = Lexer::idPool("opCatAssign");
+    postinc = Lexer::idPool("opPostInc");
+    postdec = Lexer::idPool("opPostDec");
+    index = Lexer::idPool("opIndex");
+    indexass = Lexer::idPool("opIndexAssign");
+    slice = Lexer::idPool("opSlice");
+    sliceass = Lexer::idPool("opSliceAssign");
+    call = Lexer::idPool("opCall");
+    cast = Lexer::idPool("opCast");
+    opIn = Lexer::idPool("opIn");
+    opIn_r = Lexer::idPool("opIn_r");
+    opStar = Lexer::idPool("opStar");
+    opDot = Lexer::idPool("opDot");
+    opDispatch = Lexer::idPool("opDispatch");
+    opDollar = Lexer::idPool("opDollar");
+    opUnary = Lexer::idPool("opUnary");
+    opIndexUnary = Lexer::idPool("opIndexUnary");
+    opSliceUnary = Lexer::idPool("opSliceUnary");
+    opBinary = Lexer::idPool("opBinary");
+    opBinaryRight = Lexer::idPool("opBinaryRight");
+    opOpAssign = Lexer::idPool("opOpAssign");
+    opIndexOpAssign = Lexer::idPool("opIndexOpAssign");
+    opSliceOpAssign = Lexer::idPool("opSliceOpAssign");
+    pow = Lexer::idPool("opPow");
+    pow_r = Lexer::idPool("opPow_r");
+    powass = Lexer::idPool("opPowAssign");
+    classNew = Lexer::idPool("new");
+    classDelete = Lexer::idPool("delete");
+    apply = Lexer::idPool("opApply");
+    applyReverse = Lexer::idPool("opApplyReverse");
+    Fempty = Lexer::idPool("empty");
+    Ffront = Lexer::idPool("front");
+    Fback = Lexer::idPool("back");
+    FpopFront = Lexer::idPool("popFront");
+    FpopBack = Lexer::idPool("popBack");
+    adReverse = Lexer::idPool("_adReverse");
+    aaLen = Lexer::idPool("_aaLen");
+    aaKeys = Lexer::idPool("_aaKeys");
+    aaValues = Lexer::idPool("_aaValues");
+    aaRehash = Lexer::idPool("_aaRehash");
+    monitorenter = Lexer::idPool("_d_monitorenter");
+    monitorexit = Lexer::idPool("_d_monitorexit");
+    criticalenter = Lexer::idPool("_d_criticalenter");
+    criticalexit = Lexer::idPool("_d_criticalexit");
+    _ArrayEq = Lexer::idPool("_ArrayEq");
+    lib = Lexer::idPool("lib");
+    msg = Lexer::idPool("msg");
+    startaddress = Lexer::idPool("startaddress");
+    mangle = Lexer::idPool("mangle");
+    tohash = Lexer::idPool("toHash");
+    tostring = Lexer::idPool("toString");
+    getmembers = Lexer::idPool("getMembers");
+    main = Lexer::idPool("main");
+    WinMain = Lexer::idPool("WinMain");
+    DllMain = Lexer::idPool("DllMain");
+    tls_get_addr = Lexer::idPool("___tls_get_addr");
+    entrypoint = Lexer::idPool("__entrypoint");
+    va_argsave_t = Lexer::idPool("__va_argsave_t");
+    va_argsave = Lexer::idPool("__va_argsave");
+    std = Lexer::idPool("std");
+    core = Lexer::idPool("core");
+    math = Lexer::idPool("math");
+    sin = Lexer::idPool("sin");
+    cos = Lexer::idPool("cos");
+    tan = Lexer::idPool("tan");
+    _sqrt = Lexer::idPool("sqrt");
+    _pow = Lexer::idPool("pow");
+    atan2 = Lexer::idPool("atan2");
+    rndtol = Lexer::idPool("rndtol");
+    expm1 = Lexer::idPool("expm1");
+    exp2 = Lexer::idPool("exp2");
+    yl2x = Lexer::idPool("yl2x");
+    yl2xp1 = Lexer::idPool("yl2xp1");
+    fabs = Lexer::idPool("fabs");
+    bitop = Lexer::idPool("bitop");
+    bsf = Lexer::idPool("bsf");
+    bsr = Lexer::idPool("bsr");
+    bswap = Lexer::idPool("bswap");
+    isAbstractClass = Lexer::idPool("isAbstractClass");
+    isArithmetic = Lexer::idPool("isArithmetic");
+    isAssociativeArray = Lexer::idPool("isAssociativeArray");
+    isFinalClass = Lexer::idPool("isFinalClass");
+    isPOD = Lexer::idPool("isPOD");
+    isNested = Lexer::idPool("isNested");
+    isFloating = Lexer::idPool("isFloating");
+    isIntegral = Lexer::idPool("isIntegral");
+    isScalar = Lexer::idPool("isScalar");
+    isStaticArray = Lexer::idPool("isStaticArray");
+    isUnsigned = Lexer::idPool("isUnsigned");
+    isVirtualFunction = Lexer::idPool("isVirtualFunction");
+    isVirtualMethod = Lexer::idPool("isVirtualMethod");
+    isAbstractFunction = Lexer::idPool("isAbstractFunction");
+    isFinalFunction = Lexer::idPool("isFinalFunction");
+    isOverrideFunction = Lexer::idPool("isOverrideFunction");
+    isStaticFunction = Lexer::idPool("isStaticFunction");
+    isRef = Lexer::idPool("isRef");
+    isOut = Lexer::idPool("isOut");
+    isLazy = Lexer::idPool("isLazy");
+    hasMember = Lexer::idPool("hasMember");
+    identifier = Lexer::idPool("identifier");
+    getProtection = Lexer::idPool("getProtection");
+    parent = Lexer::idPool("parent");
+    getMember = Lexer::idPool("getMember");
+    getOverloads = Lexer::idPool("getOverloads");
+    getVirtualFunctions = Lexer::idPool("getVirtualFunctions");
+    getVirtualMethods = Lexer::idPool("getVirtualMethods");
+    classInstanceSize = Lexer::idPool("classInstanceSize");
+    allMembers = Lexer::idPool("allMembers");
+    derivedMembers = Lexer::idPool("derivedMembers");
+    isSame = Lexer::idPool("isSame");
+    compiles = Lexer::idPool("compiles");
+    parameters = Lexer::idPool("parameters");
+    getAliasThis = Lexer::idPool("getAliasThis");
+    getAttributes = Lexer::idPool("getAttributes");
+    getFunctionAttributes = Lexer::idPool("getFunctionAttributes");
+    getUnitTests = Lexer::idPool("getUnitTests");
+    getVirtualIndex = Lexer::idPool("getVirtualIndex");
+}
@@ -21,6 +21,7 @@
 Identifier::Identifier(const char *string, int value)
 {
     //printf("Identifier('%s', %d)\n", string, value);
+    mem.keepRegions();          // goes in the string table for good
     this->string = string;
     this->value = value;
     this->len = strlen(string);
@@ -85,11 +86,11 @@ int Identifier::dyncast()
 
 // BUG: these are redundant with Lexer::uniqueId()
 
+size_t Identifier::generateIdCount;
+
 Identifier *Identifier::generateId(const char *prefix)
 {
-    static size_t i;
-
-    return generateId(prefix, ++i);
+    return generateId(prefix, ++generateIdCount);
 }
 
 Identifier *Identifier::generateId(const char *prefix, size_t i)
@@ -34,6 +34,7 @@ public:
     const char *toHChars2();
     int dyncast();
 
+    static size_t generateIdCount;      // last number used by generateId(prefix)
     static Identifier *generateId(const char *prefix);
     static Identifier *generateId(const char *prefix, size_t i);
 };
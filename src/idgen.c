@@ -14,6 +14,7 @@
 // Generates:
 //      id.h
 //      id.c
+//      kwtab.c
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -343,6 +344,219 @@ Msgtable msgtable[] =
     { "getVirtualIndex" }
 };
 
+// Keywords, and the token each one lexes as
+struct Kwtable
+{
+        const char *name;       // keyword
+        const char *value;      // TOK
+};
+
+Kwtable kwtable[] =
+{
+    { "this", "TOKthis" },
+    { "super", "TOKsuper" },
+    { "assert", "TOKassert" },
+    { "null", "TOKnull" },
+    { "true", "TOKtrue" },
+    { "false", "TOKfalse" },
+    { "cast", "TOKcast" },
+    { "new", "TOKnew" },
+    { "delete", "TOKdelete" },
+    { "throw", "TOKthrow" },
+    { "module", "TOKmodule" },
+    { "pragma", "TOKpragma" },
+    { "typeof", "TOKtypeof" },
+    { "typeid", "TOKtypeid" },
+
+    { "template", "TOKtemplate" },
+
+    { "void", "TOKvoid" },
+    { "byte", "TOKint8" },
+    { "ubyte", "TOKuns8" },
+    { "short", "TOKint16" },
+    { "ushort", "TOKuns16" },
+    { "int", "TOKint32" },
+    { "uint", "TOKuns32" },
+    { "long", "TOKint64" },
+    { "ulong", "TOKuns64" },
+    { "cent", "TOKint128" },
+    { "ucent", "TOKuns128" },
+    { "float", "TOKfloat32" },
+    { "double", "TOKfloat64" },
+    { "real", "TOKfloat80" },
+
+    { "bool", "TOKbool" },
+    { "char", "TOKchar" },
+    { "wchar", "TOKwchar" },
+    { "dchar", "TOKdchar" },
+
+    { "ifloat", "TOKimaginary32" },
+    { "idouble", "TOKimaginary64" },
+    { "ireal", "TOKimaginary80" },
+
+    { "cfloat", "TOKcomplex32" },
+    { "cdouble", "TOKcomplex64" },
+    { "creal", "TOKcomplex80" },
+
+    { "delegate", "TOKdelegate" },
+    { "function", "TOKfunction" },
+
+    { "is", "TOKis" },
+    { "if", "TOKif" },
+    { "else", "TOKelse" },
+    { "while", "TOKwhile" },
+    { "for", "TOKfor" },
+    { "do", "TOKdo" },
+    { "switch", "TOKswitch" },
+    { "case", "TOKcase" },
+    { "default", "TOKdefault" },
+    { "break", "TOKbreak" },
+    { "continue", "TOKcontinue" },
+    { "synchronized", "TOKsynchronized" },
+    { "return", "TOKreturn" },
+    { "goto", "TOKgoto" },
+    { "try", "TOKtry" },
+    { "catch", "TOKcatch" },
+    { "finally", "TOKfinally" },
+    { "with", "TOKwith" },
+    { "asm", "TOKasm" },
+    { "foreach", "TOKforeach" },
+    { "foreach_reverse", "TOKforeach_reverse" },
+    { "scope", "TOKscope" },
+
+    { "struct", "TOKstruct" },
+    { "class", "TOKclass" },
+    { "interface", "TOKinterface" },
+    { "union", "TOKunion" },
+    { "enum", "TOKenum" },
+    { "import", "TOKimport" },
+    { "mixin", "TOKmixin" },
+    { "static", "TOKstatic" },
+    { "final", "TOKfinal" },
+    { "const", "TOKconst" },
+    { "typedef", "TOKtypedef" },
+    { "alias", "TOKalias" },
+    { "override", "TOKoverride" },
+    { "abstract", "TOKabstract" },
+    { "volatile", "TOKvolatile" },
+    { "debug", "TOKdebug" },
+    { "deprecated", "TOKdeprecated" },
+    { "in", "TOKin" },
+    { "out", "TOKout" },
+    { "inout", "TOKinout" },
+    { "lazy", "TOKlazy" },
+    { "auto", "TOKauto" },
+
+    { "align", "TOKalign" },
+    { "extern", "TOKextern" },
+    { "private", "TOKprivate" },
+    { "package", "TOKpackage" },
+    { "protected", "TOKprotected" },
+    { "public", "TOKpublic" },
+    { "export", "TOKexport" },
+
+    { "body", "TOKbody" },
+    { "invariant", "TOKinvariant" },
+    { "unittest", "TOKunittest" },
+    { "version", "TOKversion" },
+
+    { "__argTypes", "TOKargTypes" },
+    { "__parameters", "TOKparameters" },
+    { "ref", "TOKref" },
+    { "macro", "TOKmacro" },
+
+    { "pure", "TOKpure" },
+    { "nothrow", "TOKnothrow" },
+    { "__gshared", "TOKgshared" },
+    { "__traits", "TOKtraits" },
+    { "__vector", "TOKvector" },
+    { "__overloadset", "TOKoverloadset" },
+    { "__FILE__", "TOKfile" },
+    { "__LINE__", "TOKline" },
+    { "__MODULE__", "TOKmodulestring" },
+    { "__FUNCTION__", "TOKfuncstring" },
+    { "__PRETTY_FUNCTION__", "TOKprettyfunc" },
+    { "shared", "TOKshared" },
+    { "immutable", "TOKimmutable" },
+};
+
+#define NKEYWORDS (sizeof(kwtable) / sizeof(kwtable[0]))
+#define KWBUCKETS 32            // must match the shift in kwhash()
+
+/* The hash of a possible keyword s[0..len], len >= 2, for multiplier mul.
+ * The top 5 bits pick the bucket, the rest plus the bucket's
+ * displacement pick the slot.
+ * The same function is written out to kwtab.c.
+ */
+static unsigned kwhash(const char *s, size_t len, unsigned mul)
+{
+    unsigned x = (unsigned)len;
+    x = x * mul + (unsigned char)s[0];
+    x = x * mul + (unsigned char)s[1];
+    x = x * mul + (unsigned char)s[len >> 1];
+    x = x * mul + (unsigned char)s[len - 1];
+    return x * 0x9E3779B1;
+}
+
+/* Find displacements that give each keyword a slot of its own in a
+ * table of size slots, filling in disp[] and slot[] (1 + index into
+ * kwtable[], 0 if empty).
+ * Returns:
+ *      true if it worked out
+ */
+static bool kwbuild(unsigned mul, unsigned size, unsigned char *disp, unsigned char *slot)
+{
+    unsigned bucket[NKEYWORDS];
+    unsigned hash[NKEYWORDS];
+    unsigned nbucket[KWBUCKETS];
+
+    memset(disp, 0, KWBUCKETS);
+    memset(slot, 0, size);
+    memset(nbucket, 0, sizeof(nbucket));
+    for (unsigned i = 0; i < NKEYWORDS; i++)
+    {
+        hash[i] = kwhash(kwtable[i].name, strlen(kwtable[i].name), mul);
+        bucket[i] = hash[i] >> 27;
+        nbucket[bucket[i]]++;
+    }
+
+    // Place the fullest buckets first, while there is the most room
+    for (unsigned n = NKEYWORDS; n; n--)
+    {
+        for (unsigned b = 0; b < KWBUCKETS; b++)
+        {
+            if (nbucket[b] != n)
+                continue;
+            unsigned d;
+            for (d = 0; d < 256; d++)
+            {
+                unsigned i;
+                for (i = 0; i < NKEYWORDS; i++)
+                {
+                    if (bucket[i] != b)
+                        continue;
+                    unsigned s = (hash[i] + d) & (size - 1);
+                    if (slot[s])
+                        break;
+                    slot[s] = i + 1;
+                }
+                if (i == NKEYWORDS)
+                    break;
+                // Take back what was placed before the collision
+                for (unsigned j = 0; j < i; j++)
+                {
+                    if (bucket[j] == b)
+                        slot[(hash[j] + d) & (size - 1)] = 0;
+                }
+            }
+            if (d == 256)
+                return false;
+            disp[b] = d;
+        }
+    }
+    return true;
+}
+
 
 int main()
 {
@@ -414,5 +628,74 @@ int main()
         fclose(fp);
     }
 
+    {
+        /* A perfect hash of the keywords, so the lexer can tell keywords
+         * from identifiers without going through the string table.
+         */
+        unsigned char disp[KWBUCKETS];
+        unsigned char slot[1024];
+        unsigned size;
+        unsigned mul;
+        size_t maxlen = 0;
+
+        assert(NKEYWORDS < 255);
+        for (size = 128; size <= sizeof(slot); size *= 2)
+        {
+            for (mul = 2; mul < 10000; mul++)
+            {
+                if (kwbuild(mul, size, disp, slot))
+                    goto Lfound;
+            }
+        }
+        printf("can't find a perfect hash for the keywords\n");
+        exit(EXIT_FAILURE);
+
+    Lfound:
+        fp = fopen("kwtab.c","w");
+        if (!fp)
+        {   printf("can't open kwtab.c\n");
+            exit(EXIT_FAILURE);
+        }
+
+        fprintf(fp, "// File generated by idgen.c\n");
+        fprintf(fp, "static Keyword keywords[] =\n");
+        fprintf(fp, "{\n");
+        for (i = 0; i < NKEYWORDS; i++)
+        {   const char *p = kwtable[i].name;
+            size_t len = strlen(p);
+
+            fprintf(fp, "    { \"%s\", %u, %s },\n", p, (unsigned)len, kwtable[i].value);
+            if (len > maxlen)
+                maxlen = len;
+        }
+        fprintf(fp, "};\n");
+        fprintf(fp, "#define NKEYWORDS %u\n", (unsigned)NKEYWORDS);
+        fprintf(fp, "#define KWMAXLEN %u\n", (unsigned)maxlen);
+        fprintf(fp, "#define KWTABSIZE %u\n", size);
+
+        fprintf(fp, "static const unsigned char kwdisp[%u] =\n{", KWBUCKETS);
+        for (i = 0; i < KWBUCKETS; i++)
+            fprintf(fp, "%s%u,", i % 16 ? " " : "\n    ", disp[i]);
+        fprintf(fp, "\n};\n");
+
+        fprintf(fp, "static const unsigned char kwslot[%u] =\n{", size);
+        for (i = 0; i < size; i++)
+            fprintf(fp, "%s%u,", i % 16 ? " " : "\n    ", slot[i]);
+        fprintf(fp, "\n};\n");
+
+        fprintf(fp, "static inline unsigned kwhash(const utf8_t *s, size_t len)\n");
+        fprintf(fp, "{\n");
+        fprintf(fp, "    unsigned x = (unsigned)len;\n");
+        fprintf(fp, "    x = x * %u + s[0];\n", mul);
+        fprintf(fp, "    x = x * %u + s[1];\n", mul);
+        fprintf(fp, "    x = x * %u + s[len >> 1];\n", mul);
+        fprintf(fp, "    x = x * %u + s[len - 1];\n", mul);
+        fprintf(fp, "    x *= 0x9E3779B1;\n");
+        fprintf(fp, "    return (x + kwdisp[x >> 27]) & (KWTABSIZE - 1);\n");
+        fprintf(fp, "}\n");
+
+        fclose(fp);
+    }
+
     return EXIT_SUCCESS;
 }
@@ -24,11 +24,18 @@
 #include "hdrgen.h"
 #include "template.h"
 #include "id.h"
+#include "memstats.h"
 
 /********************************** Initializer *******************************/
 
+void *Initializer::operator new(size_t size)
+{
+    return MemStats::allocate(size, NODEinitializer);
+}
+
 Initializer::Initializer(Loc loc)
 {
+    mem.keepRegions();
     this->loc = loc;
 }
 
@@ -37,6 +37,7 @@ class Initializer : public RootObject
 public:
     Loc loc;
 
+    static void *operator new(size_t size);
     Initializer(Loc loc);
     virtual Initializer *syntaxCopy() = 0;
     static Initializers *arraySyntaxCopy(Initializers *ai);
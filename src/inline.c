@@ -29,6 +29,7 @@
 #include "attrib.h"
 #include "template.h"
 #include "module.h"
+#include "timetrace.h"
 
 static Expression *expandInline(FuncDeclaration *fd, FuncDeclaration *parent,
     Expression *eret, Expression *ethis, Expressions *arguments, Statement **ps);
@@ -1591,6 +1592,7 @@ void inlineScan(Module *m)
     if (m->semanticRun != PASSsemantic3done)
         return;
     m->semanticRun = PASSinline;
+    TimeTraceScope tt("module", "inline scan", m);
 
     // Note that modules get their own scope, from scratch.
     // This is so regardless of where in the syntax a module
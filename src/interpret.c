@@ -32,6 +32,7 @@
 #include "template.h"
 #include "port.h"
 #include "ctfe.h"
+#include "memstats.h"
 
 bool walkPostorder(Expression *e, StoppableVisitor *v);
 
@@ -228,6 +229,7 @@ void CtfeStack::popAll(size_t stackpointer)
 void CtfeStack::saveGlobalConstant(VarDeclaration *v, Expression *e)
 {
      assert( v->init && (v->isConst() || v->isImmutable() || v->storage_class & STCmanifest) && !v->isCTFE());
+     mem.keepRegions();         // globalValues outlives this CTFE run
      v->ctfeAdrOnStack = (int)globalValues.dim;
      globalValues.push(e);
 }
@@ -689,6 +691,7 @@ void ctfeCompile(FuncDeclaration *fd)
     assert(!fd->semantic3Errors);
     assert(fd->semanticRun == PASSsemantic3done);
 
+    mem.keepRegions();
     fd->ctfeCode = new CompiledCtfeFunction(fd);
     if (fd->parameters)
     {
@@ -718,6 +721,14 @@ Expression *ctfeInterpret(Expression *e)
 
     unsigned olderrors = global.errors;
 
+    /* The values computed along the way are garbage once CTFE is done.
+     * Allocate them in a region, and free it if nothing long-lived was
+     * created or changed meanwhile (see Mem::keepRegions()) and the
+     * result has no parts in the region.
+     */
+    MemRegion region = mem.mark();
+    size_t nodes = MemStats::mark();
+
     // This code is outside a function, but still needs to be compiled
     // (there are compiler-generated temporary variables such as __dollar).
     // However, this will only be run once and can then be discarded.
@@ -728,6 +739,40 @@ Expression *ctfeInterpret(Expression *e)
     Expression *result = e->interpret(NULL);
     if (result != EXP_CANT_INTERPRET)
         result = scrubReturnValue(e->loc, result);
+    if (result == EXP_CANT_INTERPRET || result == e)
+    {
+        if (mem.release(&region))
+            MemStats::release(nodes, MemStats::mark());
+    }
+    else if (result->op == TOKint64 || result->op == TOKfloat64 ||
+             result->op == TOKcomplex80 || result->op == TOKnull ||
+             result->op == TOKstring)
+    {
+        // Copy it out of the region; Expression::copy() uses mem.malloc()
+        size_t regionNodes = MemStats::mark();
+        result = result->copy();
+        if (result->op == TOKstring)
+        {
+            StringExp *se = (StringExp *)result;
+            void *s = mem.malloc((se->len + 1) * se->sz);
+            memcpy(s, se->string, se->len * se->sz);
+            memset((char *)s + se->len * se->sz, 0, se->sz);
+            se->string = s;
+        }
+#ifdef DEBUG
+        // release() poisons the region, so the result must have no parts in it
+        bool escapes = mem.inRegion(&region, result) ||
+            mem.inRegion(&region, result->type) ||
+            (result->op == TOKstring && mem.inRegion(&region, ((StringExp *)result)->string));
+#endif
+        if (mem.release(&region))
+        {
+#ifdef DEBUG
+            assert(!escapes);
+#endif
+            MemStats::release(nodes, regionNodes);
+        }
+    }
     if (result == EXP_CANT_INTERPRET)
     {
         assert(global.errors != olderrors);
@@ -1272,7 +1317,10 @@ public:
                 {
                     x = getValue(v);
                     if (e->op == TOKaddress)
+                    {
+                        mem.keepRegions();
                         ((AddrExp *)e)->e1 = x;
+                    }
                     continue;
                 }
                 if (ctfeStack.isInCurrentFrame(v))
@@ -2345,6 +2393,7 @@ public:
 
             if (!v->originalType && v->scope)   // semantic() not yet run
             {
+                mem.keepRegions();
                 v->semantic (v->scope);
                 if (v->type->ty == Terror)
                     return EXP_CANT_INTERPRET;
@@ -2355,7 +2404,10 @@ public:
                 v->init && !v->isCTFE())
             {
                 if(v->scope)
+                {
+                    mem.keepRegions();
                     v->init = v->init->semantic(v->scope, v->type, INITinterpret); // might not be run on aggregate members
+                }
                 e = v->init->toExpression(v->type);
                 if (v->inuse)
                 {
@@ -2474,6 +2526,7 @@ public:
             e = s->dsym->type->defaultInitLiteral(loc);
             if (e->op == TOKerror)
                 error(loc, "CTFE failed because of previous errors in %s.init", s->toChars());
+            mem.keepRegions();
             e = e->semantic(NULL);
             if (e->op == TOKerror)
                 e = EXP_CANT_INTERPRET;
@@ -5899,7 +5952,17 @@ public:
         if (result->op == TOKarrayliteral)
             ((ArrayLiteralExp *)result)->ownedByCtfe = true;
         if (result->op == TOKstring)
-            ((StringExp *)result)->ownedByCtfe = true;
+        {
+            /* Unless Cat() handed back the data of a string literal,
+             * as for null ~ "abc", which must be copied before it can
+             * be written to.
+             */
+            StringExp *se = (StringExp *)result;
+            if (sharesLiteral(se, e1) || sharesLiteral(se, e2))
+                result = copyLiteral(se);
+            else
+                se->ownedByCtfe = true;
+        }
     }
 
 
@@ -366,7 +366,7 @@ public:
     {
         if (loc)
         {
-            const char *filename = loc->filename;
+            const char *filename = loc->filename();
             if (filename)
             {
                 if (!this->filename || strcmp(filename, this->filename))
@@ -0,0 +1,146 @@
+// File generated by idgen.c
+static Keyword keywords[] =
+{
+    { "this", 4, TOKthis },
+    { "super", 5, TOKsuper },
+    { "assert", 6, TOKassert },
+    { "null", 4, TOKnull },
+    { "true", 4, TOKtrue },
+    { "false", 5, TOKfalse },
+    { "cast", 4, TOKcast },
+    { "new", 3, TOKnew },
+    { "delete", 6, TOKdelete },
+    { "throw", 5, TOKthrow },
+    { "module", 6, TOKmodule },
+    { "pragma", 6, TOKpragma },
+    { "typeof", 6, TOKtypeof },
+    { "typeid", 6, TOKtypeid },
+    { "template", 8, TOKtemplate },
+    { "void", 4, TOKvoid },
+    { "byte", 4, TOKint8 },
+    { "ubyte", 5, TOKuns8 },
+    { "short", 5, TOKint16 },
+    { "ushort", 6, TOKuns16 },
+    { "int", 3, TOKint32 },
+    { "uint", 4, TOKuns32 },
+    { "long", 4, TOKint64 },
+    { "ulong", 5, TOKuns64 },
+    { "cent", 4, TOKint128 },
+    { "ucent", 5, TOKuns128 },
+    { "float", 5, TOKfloat32 },
+    { "double", 6, TOKfloat64 },
+    { "real", 4, TOKfloat80 },
+    { "bool", 4, TOKbool },
+    { "char", 4, TOKchar },
+    { "wchar", 5, TOKwchar },
+    { "dchar", 5, TOKdchar },
+    { "ifloat", 6, TOKimaginary32 },
+    { "idouble", 7, TOKimaginary64 },
+    { "ireal", 5, TOKimaginary80 },
+    { "cfloat", 6, TOKcomplex32 },
+    { "cdouble", 7, TOKcomplex64 },
+    { "creal", 5, TOKcomplex80 },
+    { "delegate", 8, TOKdelegate },
+    { "function", 8, TOKfunction },
+    { "is", 2, TOKis },
+    { "if", 2, TOKif },
+    { "else", 4, TOKelse },
+    { "while", 5, TOKwhile },
+    { "for", 3, TOKfor },
+    { "do", 2, TOKdo },
+    { "switch", 6, TOKswitch },
+    { "case", 4, TOKcase },
+    { "default", 7, TOKdefault },
+    { "break", 5, TOKbreak },
+    { "continue", 8, TOKcontinue },
+    { "synchronized", 12, TOKsynchronized },
+    { "return", 6, TOKreturn },
+    { "goto", 4, TOKgoto },
+    { "try", 3, TOKtry },
+    { "catch", 5, TOKcatch },
+    { "finally", 7, TOKfinally },
+    { "with", 4, TOKwith },
+    { "asm", 3, TOKasm },
+    { "foreach", 7, TOKforeach },
+    { "foreach_reverse", 15, TOKforeach_reverse },
+    { "scope", 5, TOKscope },
+    { "struct", 6, TOKstruct },
+    { "class", 5, TOKclass },
+    { "interface", 9, TOKinterface },
+    { "union", 5, TOKunion },
+    { "enum", 4, TOKenum },
+    { "import", 6, TOKimport },
+    { "mixin", 5, TOKmixin },
+    { "static", 6, TOKstatic },
+    { "final", 5, TOKfinal },
+    { "const", 5, TOKconst },
+    { "typedef", 7, TOKtypedef },
+    { "alias", 5, TOKalias },
+    { "override", 8, TOKoverride },
+    { "abstract", 8, TOKabstract },
+    { "volatile", 8, TOKvolatile },
+    { "debug", 5, TOKdebug },
+    { "deprecated", 10, TOKdeprecated },
+    { "in", 2, TOKin },
+    { "out", 3, TOKout },
+    { "inout", 5, TOKinout },
+    { "lazy", 4, TOKlazy },
+    { "auto", 4, TOKauto },
+    { "align", 5, TOKalign },
+    { "extern", 6, TOKextern },
+    { "private", 7, TOKprivate },
+    { "package", 7, TOKpackage },
+    { "protected", 9, TOKprotected },
+    { "public", 6, TOKpublic },
+    { "export", 6, TOKexport },
+    { "body", 4, TOKbody },
+    { "invariant", 9, TOKinvariant },
+    { "unittest", 8, TOKunittest },
+    { "version", 7, TOKversion },
+    { "__argTypes", 10, TOKargTypes },
+    { "__parameters", 12, TOKparameters },
+    { "ref", 3, TOKref },
+    { "macro", 5, TOKmacro },
+    { "pure", 4, TOKpure },
+    { "nothrow", 7, TOKnothrow },
+    { "__gshared", 9, TOKgshared },
+    { "__traits", 8, TOKtraits },
+    { "__vector", 8, TOKvector },
+    { "__overloadset", 13, TOKoverloadset },
+    { "__FILE__", 8, TOKfile },
+    { "__LINE__", 8, TOKline },
+    { "__MODULE__", 10, TOKmodulestring },
+    { "__FUNCTION__", 12, TOKfuncstring },
+    { "__PRETTY_FUNCTION__", 19, TOKprettyfunc },
+    { "shared", 6, TOKshared },
+    { "immutable", 9, TOKimmutable },
+};
+#define NKEYWORDS 113
+#define KWMAXLEN 19
+#define KWTABSIZE 128
+static const unsigned char kwdisp[32] =
+{
+    1, 0, 5, 2, 0, 0, 0, 7, 2, 8, 5, 11, 0, 0, 71, 11,
+    1, 4, 26, 5, 11, 3, 27, 16, 3, 8, 13, 37, 8, 23, 15, 1,
+};
+static const unsigned char kwslot[128] =
+{
+    110, 46, 27, 87, 0, 56, 111, 79, 30, 0, 19, 28, 24, 47, 94, 58,
+    82, 11, 31, 93, 63, 106, 22, 67, 49, 70, 43, 105, 14, 38, 97, 76,
+    100, 113, 61, 59, 48, 9, 32, 83, 1, 45, 95, 39, 53, 57, 35, 65,
+    89, 44, 73, 5, 88, 23, 40, 29, 85, 68, 0, 10, 41, 64, 0, 0,
+    62, 37, 0, 52, 21, 84, 66, 74, 78, 72, 98, 26, 12, 80, 108, 4,
+    81, 71, 91, 75, 60, 0, 92, 0, 2, 0, 17, 18, 90, 107, 0, 0,
+    86, 25, 99, 103, 101, 42, 16, 15, 0, 77, 112, 54, 36, 6, 96, 34,
+    0, 51, 69, 3, 7, 104, 13, 0, 50, 0, 8, 20, 109, 33, 102, 55,
+};
+static inline unsigned kwhash(const utf8_t *s, size_t len)
+{
+    unsigned x = (unsigned)len;
+    x = x * 9 + s[0];
+    x = x * 9 + s[1];
+    x = x * 9 + s[len >> 1];
+    x = x * 9 + s[len - 1];
+    x *= 0x9E3779B1;
+    return (x + kwdisp[x >> 27]) & (KWTABSIZE - 1);
+}
@@ -21,9 +21,16 @@
 #include <assert.h>
 #include <time.h>       // for time() and ctime()
 
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && \
+    !defined(__SANITIZE_ADDRESS__)
+#include <emmintrin.h>
+#define LEX_SSE2 1
+#endif
+
 #include "rmem.h"
 
 #include "stringtable.h"
+#include "thread.h"
 
 #include "lexer.h"
 #include "utf.h"
@@ -65,24 +72,193 @@ static void cmtable_init()
     }
 }
 
+/********************************************
+ * The keywords, and a perfect hash of them generated by idgen.c,
+ * so identifiers can be told from keywords without a trip through
+ * the string table.
+ */
 
-/************************* Token **********************************************/
+struct Keyword
+{   const char *name;
+    size_t len;
+    TOK value;
+    Identifier *ident;          // set by initKeywords()
+};
 
-const char *Token::tochars[TOKMAX];
+#include "kwtab.c"
+
+/********************************************
+ * Returns:
+ *      the keyword s[0..len], or NULL if it isn't one
+ */
+
+inline Keyword *lookupKeyword(const utf8_t *s, size_t len)
+{
+    if (len < 2 || len > KWMAXLEN)
+        return NULL;
+    unsigned i = kwslot[kwhash(s, len)];
+    if (!i)
+        return NULL;
+    Keyword *kw = &keywords[i - 1];
+    if (kw->len != len || memcmp(kw->name, s, len) != 0)
+        return NULL;
+    return kw;
+}
+
+/********************************************
+ * Kernels for the inner loops of scan(). Each skips a run of bytes and
+ * returns a pointer to the first one that stops it. The source always
+ * ends with a 0 or 0x1A, which stops every run.
+ *
+ * Most runs are short, so the first few bytes are tested one at a time.
+ * After that the SSE2 version tests 16 bytes at a time. It only loads
+ * from 16 byte aligned addresses, which cannot cross into the next page,
+ * so reading past the terminating 0 never faults.
+ */
+
+#if LEX_SSE2
+
+inline int lowestBit(unsigned m)
+{
+#if __GNUC__
+    return __builtin_ctz(m);
+#else
+    int i = 0;
+    while (!(m & 1))
+    {
+        m >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+
+#endif
+
+// Bytes that are not [0-9A-Za-z_]
+struct IdcharStop
+{
+    bool operator()(utf8_t c) const { return !isidchar(c); }
+#if LEX_SSE2
+    unsigned operator()(__m128i v) const
+    {
+        // Bytes >= 0x80 compare as negative
+        __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                      _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                      _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+        __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+        return ~_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), under)) & 0xFFFF;
+    }
+#endif
+};
+
+// Bytes that are not ' ', '\t', '\v' or '\f'
+struct BlankStop
+{
+    bool operator()(utf8_t c) const
+    {
+        return !(c == ' ' || c == '\t' || c == '\v' || c == '\f');
+    }
+#if LEX_SSE2
+    unsigned operator()(__m128i v) const
+    {
+        __m128i b = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\v')),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8('\f'))));
+        return ~_mm_movemask_epi8(b) & 0xFFFF;
+    }
+#endif
+};
+
+// Bytes that are c1, c2, '\n', '\r', 0, 0x1A or >= 0x80
+struct CharStop
+{
+    utf8_t c1, c2;
 
-void *Token::operator new(size_t size)
-{   Token *t;
+    CharStop(utf8_t c1, utf8_t c2) : c1(c1), c2(c2) { }
+
+    bool operator()(utf8_t c) const
+    {
+        return c == c1 || c == c2 || c == '\n' || c == '\r' ||
+               c == 0 || c == 0x1A || (c & 0x80);
+    }
+#if LEX_SSE2
+    unsigned operator()(__m128i v) const
+    {
+        __m128i s = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)c1)),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8((char)c2))),
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+        s = _mm_or_si128(s,
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_setzero_si128()),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8(0x1A))));
+        return _mm_movemask_epi8(_mm_or_si128(s, v));   // or'ing in v adds the top bits
+    }
+#endif
+};
 
-    if (Lexer::freelist)
+template <class Stop>
+inline const utf8_t *scanTo(const utf8_t *p, Stop stop)
+{
+#if LEX_SSE2
+    for (int i = 0; i < 8; i++, p++)
     {
-        t = Lexer::freelist;
-        Lexer::freelist = t->next;
-        return t;
+        if (stop(*p))
+            return p;
     }
+    size_t off = (size_t)p & 15;
+    const __m128i *q = (const __m128i *)(p - off);
+    unsigned m = stop(_mm_load_si128(q)) >> off;       // drop the bytes before p
+    if (m)
+        return p + lowestBit(m);
+    while (!(m = stop(_mm_load_si128(++q))))
+        ;
+    return (const utf8_t *)q + lowestBit(m);
+#else
+    while (!stop(*p))
+        p++;
+    return p;
+#endif
+}
+
+inline const utf8_t *skipIdchars(const utf8_t *p)
+{
+    return scanTo(p, IdcharStop());
+}
+
+inline const utf8_t *skipBlanks(const utf8_t *p)
+{
+    return scanTo(p, BlankStop());
+}
 
-    return ::operator new(size);
+inline const utf8_t *skipTo(const utf8_t *p, utf8_t c1, utf8_t c2)
+{
+    return scanTo(p, CharStop(c1, c2));
 }
 
+/* Skip the run of valid multi-byte characters at p, stopping at ASCII,
+ * at anything decodeUTF() would complain about, and at LS and PS.
+ * The source is 0 terminated, so the run is decoded without a length.
+ */
+inline const utf8_t *skipMultibyte(const utf8_t *p)
+{
+    dchar_t c;
+    size_t n;
+    while ((n = utf_decodeMultibyte(p, 4, &c)) != 0 && c != LS && c != PS)
+        p += n;
+    return p;
+}
+
+
+/************************* Token **********************************************/
+
+const char *Token::tochars[TOKMAX];
+
 #ifdef DEBUG
 void Token::print()
 {
@@ -239,9 +415,18 @@ const char *Token::toChars(TOK value)
 
 /*************************** Lexer ********************************************/
 
-Token *Lexer::freelist = NULL;
 StringTable Lexer::stringtable;
-OutBuffer Lexer::stringbuffer;
+StringTable Lexer::literals;
+bool Lexer::threaded = false;
+
+static Mutex stringtableLock;   // guards stringtable while Lexer::threaded
+static Mutex literalsLock;      // guards literals while Lexer::threaded
+
+/* Values for __DATE__, __TIME__ and __TIMESTAMP__
+ */
+static char datestr[11+1];
+static char timestr[8+1];
+static char timestampstr[24+1];
 
 Lexer::Lexer(Module *mod,
         const utf8_t *base, size_t begoffset, size_t endoffset,
@@ -259,6 +444,13 @@ Lexer::Lexer(Module *mod,
     this->doDocComment = doDocComment;
     this->anyToken = 0;
     this->commentToken = commentToken;
+    this->gagErrors = 0;
+    this->gaggedErrors = 0;
+    this->lexed = NULL;
+    this->ahead = NULL;
+    this->aheadStart = 0;
+    this->aheadDim = 0;
+    this->spare = NULL;
     //initKeywords();
 
     /* If first line starts with '#!', ignore the line
@@ -301,6 +493,24 @@ Lexer::Lexer(Module *mod,
 }
 
 
+Lexer::~Lexer()
+{
+    // Spares still being looked ahead at go with the rest
+    while (token.next)
+    {
+        Token *t = token.next;
+        token.next = t->next;
+        freeToken(t);
+    }
+    while (spare)
+    {
+        Token *t = spare;
+        spare = t->next;
+        mem.free(t);
+    }
+    mem.free(ahead);
+}
+
 void Lexer::endOfLine()
 {
     scanloc.linnum++;
@@ -315,6 +525,11 @@ Loc Lexer::loc()
 
 void Lexer::error(const char *format, ...)
 {
+    if (gagErrors)
+    {
+        gaggedErrors++;
+        return;
+    }
     va_list ap;
     va_start(ap, format);
     ::verror(token.loc, format, ap);
@@ -323,6 +538,11 @@ void Lexer::error(const char *format, ...)
 
 void Lexer::error(Loc loc, const char *format, ...)
 {
+    if (gagErrors)
+    {
+        gaggedErrors++;
+        return;
+    }
     va_list ap;
     va_start(ap, format);
     ::verror(loc, format, ap);
@@ -331,20 +551,68 @@ void Lexer::error(Loc loc, const char *format, ...)
 
 void Lexer::deprecation(const char *format, ...)
 {
+    if (gagErrors)
+    {
+        gaggedErrors++;
+        return;
+    }
     va_list ap;
     va_start(ap, format);
     ::vdeprecation(token.loc, format, ap);
     va_end(ap);
 }
 
+/*********************************
+ * Get a token to look ahead with. Tokens are used in the order
+ * they are allocated, so the ring buffer is a queue.
+ */
+
+#define LOOKAHEAD 64            // tokens in the ring buffer, a power of 2
+
+Token *Lexer::allocToken()
+{
+    Token *t;
+    if (!ahead)
+        ahead = (Token *)mem.malloc(LOOKAHEAD * sizeof(Token));
+    if (aheadDim < LOOKAHEAD)
+        t = &ahead[(aheadStart + aheadDim++) & (LOOKAHEAD - 1)];
+    else if (spare)
+    {
+        t = spare;
+        spare = t->next;
+    }
+    else
+        t = (Token *)mem.malloc(sizeof(Token));
+    t->next = NULL;
+    return t;
+}
+
+/*********************************
+ * Give back the oldest token from allocToken().
+ */
+
+void Lexer::freeToken(Token *t)
+{
+    if (t >= ahead && t < ahead + LOOKAHEAD)
+    {
+        assert(aheadDim && t == &ahead[aheadStart]);
+        aheadStart = (aheadStart + 1) & (LOOKAHEAD - 1);
+        aheadDim--;
+    }
+    else
+    {
+        t->next = spare;
+        spare = t;
+    }
+}
+
 TOK Lexer::nextToken()
 {
     if (token.next)
     {
         Token *t = token.next;
         memcpy(&token,t,sizeof(Token));
-        t->next = freelist;
-        freelist = t;
+        freeToken(t);
     }
     else
     {
@@ -361,7 +629,7 @@ Token *Lexer::peek(Token *ct)
         t = ct->next;
     else
     {
-        t = new Token();
+        t = allocToken();
         scan(t);
         ct->next = t;
     }
@@ -480,6 +748,19 @@ Linvalid:
 
 void Lexer::scan(Token *t)
 {
+    if (lexed)
+    {
+        // Replay token scanned ahead by scanAll()
+        Token *next = t->next;
+        memcpy(t, lexed, sizeof(Token));
+        t->next = next;
+        if (lexed->value == TOKeof)
+            scanloc.linnum = lexed->loc.linnum;
+        else
+            lexed++;
+        return;
+    }
+
     unsigned lastLine = scanloc.linnum;
     Loc startLoc;
 
@@ -501,7 +782,7 @@ void Lexer::scan(Token *t)
             case '\t':
             case '\v':
             case '\f':
-                p++;
+                p = skipBlanks(p + 1);
                 continue;                       // skip white space
 
             case '\r':
@@ -583,9 +864,7 @@ void Lexer::scan(Token *t)
                     }
                 } while (*p == '\\');
                 t->len = (unsigned)stringbuffer.offset;
-                stringbuffer.writeByte(0);
-                t->ustring = (utf8_t *)mem.malloc(stringbuffer.offset);
-                memcpy(t->ustring, stringbuffer.data, stringbuffer.offset);
+                t->ustring = literalPool((utf8_t *)stringbuffer.data, t->len);
                 t->postfix = 0;
                 t->value = TOKstring;
                 error("Escape String literal %.*s is deprecated, use double quoted string literal \"%.*s\" instead", p - pstart, pstart, p - pstart, pstart);
@@ -610,10 +889,9 @@ void Lexer::scan(Token *t)
 
                 while (1)
                 {
-                    c = *++p;
-                    if (isidchar(c))
-                        continue;
-                    else if (c & 0x80)
+                    p = skipIdchars(p + 1);
+                    c = *p;
+                    if (c & 0x80)
                     {   const utf8_t *s = p;
                         unsigned u = decodeUTF();
                         if (isUniAlpha(u))
@@ -624,42 +902,24 @@ void Lexer::scan(Token *t)
                     break;
                 }
 
-                StringValue *sv = stringtable.update((char *)t->ptr, p - t->ptr);
-                Identifier *id = (Identifier *) sv->ptrvalue;
-                if (!id)
-                {   id = new Identifier(sv->toDchars(),TOKidentifier);
-                    sv->ptrvalue = (char *)id;
-                }
+                Identifier *id;
+                if (Keyword *kw = lookupKeyword(t->ptr, p - t->ptr))
+                    id = kw->ident;
+                else
+                    id = idPool((const char *)t->ptr, p - t->ptr);
                 t->ident = id;
                 t->value = (TOK) id->value;
                 anyToken = 1;
                 if (*t->ptr == '_')     // if special identifier token
                 {
-                    static bool initdone = false;
-                    static char date[11+1];
-                    static char time[8+1];
-                    static char timestamp[24+1];
-
-                    if (!initdone)       // lazy evaluation
-                    {
-                        initdone = true;
-                        time_t ct;
-                        ::time(&ct);
-                        char *p = ctime(&ct);
-                        assert(p);
-                        sprintf(&date[0], "%.6s %.4s", p + 4, p + 20);
-                        sprintf(&time[0], "%.8s", p + 11);
-                        sprintf(&timestamp[0], "%.24s", p);
-                    }
-
                     if (id == Id::DATE)
                     {
-                        t->ustring = (utf8_t *)date;
+                        t->ustring = (utf8_t *)datestr;
                         goto Lstr;
                     }
                     else if (id == Id::TIME)
                     {
-                        t->ustring = (utf8_t *)time;
+                        t->ustring = (utf8_t *)timestr;
                         goto Lstr;
                     }
                     else if (id == Id::VENDOR)
@@ -669,7 +929,7 @@ void Lexer::scan(Token *t)
                     }
                     else if (id == Id::TIMESTAMP)
                     {
-                        t->ustring = (utf8_t *)timestamp;
+                        t->ustring = (utf8_t *)timestampstr;
                      Lstr:
                         t->value = TOKstring;
                         t->postfix = 0;
@@ -726,7 +986,8 @@ void Lexer::scan(Token *t)
                         while (1)
                         {
                             while (1)
-                            {   utf8_t c = *p;
+                            {   p = skipTo(p, '/', '/');
+                                utf8_t c = *p;
                                 switch (c)
                                 {
                                     case '/':
@@ -753,7 +1014,12 @@ void Lexer::scan(Token *t)
 
                                     default:
                                         if (c & 0x80)
-                                        {   unsigned u = decodeUTF();
+                                        {   const utf8_t *q = skipMultibyte(p);
+                                            if (q != p)
+                                            {   p = q;
+                                                continue;
+                                            }
+                                            unsigned u = decodeUTF();
                                             if (u == PS || u == LS)
                                                 endOfLine();
                                         }
@@ -781,7 +1047,8 @@ void Lexer::scan(Token *t)
                     case '/':           // do // style comments
                         startLoc = loc();
                         while (1)
-                        {   utf8_t c = *++p;
+                        {   p = skipTo(p + 1, '\n', '\n');
+                            utf8_t c = *p;
                             switch (c)
                             {
                                 case '\n':
@@ -810,7 +1077,12 @@ void Lexer::scan(Token *t)
 
                                 default:
                                     if (c & 0x80)
-                                    {   unsigned u = decodeUTF();
+                                    {   const utf8_t *q = skipMultibyte(p);
+                                        if (q != p)
+                                        {   p = q - 1;
+                                            continue;
+                                        }
+                                        unsigned u = decodeUTF();
                                         if (u == PS || u == LS)
                                             break;
                                     }
@@ -841,7 +1113,8 @@ void Lexer::scan(Token *t)
                         p++;
                         nest = 1;
                         while (1)
-                        {   utf8_t c = *p;
+                        {   p = skipTo(p, '/', '+');
+                            utf8_t c = *p;
                             switch (c)
                             {
                                 case '/':
@@ -884,7 +1157,12 @@ void Lexer::scan(Token *t)
 
                                 default:
                                     if (c & 0x80)
-                                    {   unsigned u = decodeUTF();
+                                    {   const utf8_t *q = skipMultibyte(p);
+                                        if (q != p)
+                                        {   p = q;
+                                            continue;
+                                        }
+                                        unsigned u = decodeUTF();
                                         if (u == PS || u == LS)
                                             endOfLine();
                                     }
@@ -1204,6 +1482,45 @@ void Lexer::scan(Token *t)
     }
 }
 
+/****************************
+ * Scan the rest of the buffer into an array of tokens, ending
+ * with TOKeof, for another Lexer on the same buffer to replay
+ * through Lexer::lexed. This lets the lexing be done on a worker
+ * thread ahead of the Parser.
+ * Returns:
+ *      the tokens, or NULL if there were any diagnostics; those are
+ *      left to the ordinary scan so they get reported in order
+ */
+
+Token *Lexer::scanAll()
+{
+    gagErrors++;
+    size_t dim = 0;
+    size_t allocdim = 1024;
+    Token *tokens = (Token *)mem.malloc(allocdim * sizeof(Token));
+    while (1)
+    {
+        if (dim == allocdim)
+        {
+            allocdim *= 2;
+            tokens = (Token *)mem.realloc(tokens, allocdim * sizeof(Token));
+        }
+        Token *t = &tokens[dim++];
+        t->next = NULL;
+        scan(t);
+        if (gaggedErrors)
+        {
+            mem.free(tokens);
+            tokens = NULL;
+            break;
+        }
+        if (t->value == TOKeof)
+            break;
+    }
+    gagErrors--;
+    return tokens;
+}
+
 /*******************************************
  * Parse escape sequence.
  */
@@ -1339,6 +1656,9 @@ TOK Lexer::wysiwygStringConstant(Token *t, int tc)
     stringbuffer.reset();
     while (1)
     {
+        const utf8_t *q = skipTo(p, (utf8_t)tc, (utf8_t)tc);
+        stringbuffer.write(p, q - p);
+        p = q;
         c = *p++;
         switch (c)
         {
@@ -1366,9 +1686,7 @@ TOK Lexer::wysiwygStringConstant(Token *t, int tc)
                 if (c == tc)
                 {
                     t->len = (unsigned)stringbuffer.offset;
-                    stringbuffer.writeByte(0);
-                    t->ustring = (utf8_t *)mem.malloc(stringbuffer.offset);
-                    memcpy(t->ustring, stringbuffer.data, stringbuffer.offset);
+                    t->ustring = literalPool((utf8_t *)stringbuffer.data, t->len);
                     stringPostfix(t);
                     return TOKstring;
                 }
@@ -1377,6 +1695,13 @@ TOK Lexer::wysiwygStringConstant(Token *t, int tc)
             default:
                 if (c & 0x80)
                 {   p--;
+                    const utf8_t *q = skipMultibyte(p);
+                    if (q != p)
+                    {   // copy the valid run as it is
+                        stringbuffer.write(p, q - p);
+                        p = q;
+                        continue;
+                    }
                     unsigned u = decodeUTF();
                     p++;
                     if (u == PS || u == LS)
@@ -1437,9 +1762,7 @@ TOK Lexer::hexStringConstant(Token *t)
                     stringbuffer.writeByte(v);
                 }
                 t->len = (unsigned)stringbuffer.offset;
-                stringbuffer.writeByte(0);
-                t->ustring = (utf8_t *)mem.malloc(stringbuffer.offset);
-                memcpy(t->ustring, stringbuffer.data, stringbuffer.offset);
+                t->ustring = literalPool((utf8_t *)stringbuffer.data, t->len);
                 stringPostfix(t);
                 return TOKxstring;
 
@@ -1621,9 +1944,7 @@ Ldone:
     else
         error("delimited string must end in %c\"", delimright);
     t->len = (unsigned)stringbuffer.offset;
-    stringbuffer.writeByte(0);
-    t->ustring = (utf8_t *)mem.malloc(stringbuffer.offset);
-    memcpy(t->ustring, stringbuffer.data, stringbuffer.offset);
+    t->ustring = literalPool((utf8_t *)stringbuffer.data, t->len);
     stringPostfix(t);
     return TOKstring;
 
@@ -1675,9 +1996,7 @@ TOK Lexer::tokenStringConstant(Token *t)
 
 Ldone:
     t->len = (unsigned)(p - 1 - pstart);
-    t->ustring = (utf8_t *)mem.malloc(t->len + 1);
-    memcpy(t->ustring, pstart, t->len);
-    t->ustring[t->len] = 0;
+    t->ustring = literalPool(pstart, t->len);
     stringPostfix(t);
     return TOKstring;
 
@@ -1703,6 +2022,9 @@ TOK Lexer::escapeStringConstant(Token *t, int wide)
     stringbuffer.reset();
     while (1)
     {
+        const utf8_t *q = skipTo(p, '"', '\\');
+        stringbuffer.write(p, q - p);
+        p = q;
         c = *p++;
         switch (c)
         {
@@ -1734,9 +2056,7 @@ TOK Lexer::escapeStringConstant(Token *t, int wide)
 
             case '"':
                 t->len = (unsigned)stringbuffer.offset;
-                stringbuffer.writeByte(0);
-                t->ustring = (utf8_t *)mem.malloc(stringbuffer.offset);
-                memcpy(t->ustring, stringbuffer.data, stringbuffer.offset);
+                t->ustring = literalPool((utf8_t *)stringbuffer.data, t->len);
                 stringPostfix(t);
                 return TOKstring;
 
@@ -1753,6 +2073,13 @@ TOK Lexer::escapeStringConstant(Token *t, int wide)
                 if (c & 0x80)
                 {
                     p--;
+                    const utf8_t *q = skipMultibyte(p);
+                    if (q != p)
+                    {   // copy the valid run as it is
+                        stringbuffer.write(p, q - p);
+                        p = q;
+                        continue;
+                    }
                     c = decodeUTF();
                     if (c == LS || c == PS)
                     {   c = '\n';
@@ -1928,6 +2255,16 @@ TOK Lexer::number(Token *t)
                 break;
         }
     }
+    else if (c >= '1' && c <= '9')
+    {
+        // No 19 digit decimal number can overflow, so skip the checks
+        const utf8_t *pend = p + 19;
+        do
+        {
+            n = n * 10 + (c - '0');
+            c = *++p;
+        } while (c >= '0' && c <= '9' && p < pend);
+    }
 
     while (1)
     {
@@ -2155,6 +2492,22 @@ Ldone:
     return result;
 }
 
+/* Where long double is the x87 80 bit type, a decimal literal with at
+ * most 19 significant digits, and a power of 10 up to 10^27, are both
+ * exact. So is their product or quotient, up to the one rounding
+ * (Clinger's fast path), and that is what strtold() would return.
+ */
+#if !_MSC_VER && (__linux__ || __APPLE__) && (__i386__ || __x86_64__)
+#define LEX_FASTREAL 1
+
+static const longdouble pow10tab[] =
+{
+    1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,  1e8L,  1e9L,
+    1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+    1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L,
+};
+#endif
+
 /**************************************
  * Read in characters, converting them to real.
  * Bugs:
@@ -2173,6 +2526,11 @@ TOK Lexer::inreal(Token *t)
     char hex = 0;
     unsigned c = *p++;
 
+    // For the fast path: the significant digits, and the power of 10
+    d_uns64 mant = 0;
+    int ndigits = 0;                    // significant digits, at most 19 used
+    int exp10 = 0;
+
     // Leading '0x'
     if (c == '0')
     {
@@ -2194,6 +2552,11 @@ TOK Lexer::inreal(Token *t)
         }
         if (isdigit(c) || (hex && isxdigit(c)) || c == '_')
         {
+            if (isdigit(c) && (ndigits || c != '0'))
+            {
+                if (++ndigits <= 19)
+                    mant = mant * 10 + (c - '0');
+            }
             c = *p++;
             continue;
         }
@@ -2205,6 +2568,15 @@ TOK Lexer::inreal(Token *t)
     {
         if (isdigit(c) || (hex && isxdigit(c)) || c == '_')
         {
+            if (isdigit(c))
+            {
+                exp10--;
+                if (ndigits || c != '0')
+                {
+                    if (++ndigits <= 19)
+                        mant = mant * 10 + (c - '0');
+                }
+            }
             c = *p++;
             continue;
         }
@@ -2214,16 +2586,21 @@ TOK Lexer::inreal(Token *t)
     if (c == 'e' || c == 'E' || (hex && (c == 'p' || c == 'P')))
     {
         c = *p++;
+        bool negexp = false;
         if (c == '-' || c == '+')
         {
+            negexp = c == '-';
             c = *p++;
         }
         bool anyexp = false;
+        int e = 0;
         while (1)
         {
             if (isdigit(c))
             {
                 anyexp = true;
+                if (e < 100000)
+                    e = e * 10 + (c - '0');
                 c = *p++;
                 continue;
             }
@@ -2236,28 +2613,54 @@ TOK Lexer::inreal(Token *t)
                 error("missing exponent");
             break;
         }
+        exp10 += negexp ? -e : e;
     }
     else if (hex)
         error("exponent required for hex float");
     --p;
-    while (pstart < p)
+
+    TOK result;
+    bool exact = false;
+#if LEX_FASTREAL
+    if (!hex && ndigits <= 19 && (mant == 0 || (exp10 >= -27 && exp10 <= 27)))
     {
-        if (*pstart != '_')
-            stringbuffer.writeByte(*pstart);
-        ++pstart;
+        longdouble v = (longdouble)mant;
+        if (mant && exp10 < 0)
+            v /= pow10tab[-exp10];
+        else if (mant)
+            v *= pow10tab[exp10];
+
+        /* The result is well inside the range of double, but could
+         * be too big for float. Let strtof() decide.
+         */
+        if (!((*p == 'f' || *p == 'F') && v > 3.4e38L))
+        {
+            t->float80value = v;
+            exact = true;
+        }
     }
+#endif
+    if (!exact)
+    {
+        while (pstart < p)
+        {
+            if (*pstart != '_')
+                stringbuffer.writeByte(*pstart);
+            ++pstart;
+        }
 
-    stringbuffer.writeByte(0);
+        stringbuffer.writeByte(0);
 
-    TOK result;
-    t->float80value = Port::strtold((char *)stringbuffer.data, NULL);
+        t->float80value = Port::strtold((char *)stringbuffer.data, NULL);
+    }
     errno = 0;
     switch (*p)
     {
         case 'F':
         case 'f':
             // Only interested in errno return
-            (void)Port::strtof((char *)stringbuffer.data, NULL);
+            if (!exact)
+                (void)Port::strtof((char *)stringbuffer.data, NULL);
             result = TOKfloat32v;
             p++;
             break;
@@ -2268,7 +2671,8 @@ TOK Lexer::inreal(Token *t)
              * 2.22508e-308. Not sure who is right.
              */
             // Only interested in errno return
-            (void)Port::strtod((char *)stringbuffer.data, NULL);
+            if (!exact)
+                (void)Port::strtod((char *)stringbuffer.data, NULL);
             result = TOKfloat64v;
             break;
 
@@ -2354,7 +2758,7 @@ void Lexer::poundLine()
             Lnewline:
                 this->scanloc.linnum = linnum;
                 if (filespec)
-                    this->scanloc.filename = filespec;
+                    this->scanloc.setFilename(filespec);
                 return;
 
             case '\r':
@@ -2376,7 +2780,7 @@ void Lexer::poundLine()
                 if (mod && memcmp(p, "__FILE__", 8) == 0)
                 {
                     p += 8;
-                    filespec = mem.strdup(scanloc.filename ? scanloc.filename : mod->ident->toChars());
+                    filespec = mem.strdup(scanloc.filename() ? scanloc.filename() : mod->ident->toChars());
                     continue;
                 }
                 goto Lerr;
@@ -2667,7 +3071,13 @@ const utf8_t *Lexer::combineComments(const utf8_t *c1, const utf8_t *c2)
 
 Identifier *Lexer::idPool(const char *s)
 {
-    size_t len = strlen(s);
+    return idPool(s, strlen(s));
+}
+
+Identifier *Lexer::idPool(const char *s, size_t len)
+{
+    if (threaded)
+        stringtableLock.lock();
     StringValue *sv = stringtable.update(s, len);
     Identifier *id = (Identifier *) sv->ptrvalue;
     if (!id)
@@ -2675,9 +3085,28 @@ Identifier *Lexer::idPool(const char *s)
         id = new Identifier(sv->toDchars(), TOKidentifier);
         sv->ptrvalue = (char *)id;
     }
+    if (threaded)
+        stringtableLock.unlock();
     return id;
 }
 
+/********************************************
+ * Intern the payload of a string literal, so that literals with
+ * the same contents, in any module, share one copy.
+ * The copy is 0 terminated, and must never be written to: CTFE
+ * copies a literal before it modifies it (see copyLiteral()).
+ */
+
+utf8_t *Lexer::literalPool(const utf8_t *s, size_t len)
+{
+    if (threaded)
+        literalsLock.lock();
+    StringValue *sv = literals.update((const char *)s, len);
+    if (threaded)
+        literalsLock.unlock();
+    return (utf8_t *)sv->toDchars();
+}
+
 /*********************************************
  * Create a unique identifier using the prefix s.
  */
@@ -2693,154 +3122,16 @@ Identifier *Lexer::uniqueId(const char *s, int num)
     return idPool(buffer);
 }
 
+int Lexer::uniqueIdCount;
+
 Identifier *Lexer::uniqueId(const char *s)
 {
-    static int num;
-    return uniqueId(s, ++num);
+    return uniqueId(s, ++uniqueIdCount);
 }
 
-/****************************************
- */
-
-struct Keyword
-{   const char *name;
-    TOK value;
-};
-
-static size_t nkeywords;
-static Keyword keywords[] =
-{
-    {   "this",         TOKthis         },
-    {   "super",        TOKsuper        },
-    {   "assert",       TOKassert       },
-    {   "null",         TOKnull         },
-    {   "true",         TOKtrue         },
-    {   "false",        TOKfalse        },
-    {   "cast",         TOKcast         },
-    {   "new",          TOKnew          },
-    {   "delete",       TOKdelete       },
-    {   "throw",        TOKthrow        },
-    {   "module",       TOKmodule       },
-    {   "pragma",       TOKpragma       },
-    {   "typeof",       TOKtypeof       },
-    {   "typeid",       TOKtypeid       },
-
-    {   "template",     TOKtemplate     },
-
-    {   "void",         TOKvoid         },
-    {   "byte",         TOKint8         },
-    {   "ubyte",        TOKuns8         },
-    {   "short",        TOKint16        },
-    {   "ushort",       TOKuns16        },
-    {   "int",          TOKint32        },
-    {   "uint",         TOKuns32        },
-    {   "long",         TOKint64        },
-    {   "ulong",        TOKuns64        },
-    {   "cent",         TOKint128,      },
-    {   "ucent",        TOKuns128,      },
-    {   "float",        TOKfloat32      },
-    {   "double",       TOKfloat64      },
-    {   "real",         TOKfloat80      },
-
-    {   "bool",         TOKbool         },
-    {   "char",         TOKchar         },
-    {   "wchar",        TOKwchar        },
-    {   "dchar",        TOKdchar        },
-
-    {   "ifloat",       TOKimaginary32  },
-    {   "idouble",      TOKimaginary64  },
-    {   "ireal",        TOKimaginary80  },
-
-    {   "cfloat",       TOKcomplex32    },
-    {   "cdouble",      TOKcomplex64    },
-    {   "creal",        TOKcomplex80    },
-
-    {   "delegate",     TOKdelegate     },
-    {   "function",     TOKfunction     },
-
-    {   "is",           TOKis           },
-    {   "if",           TOKif           },
-    {   "else",         TOKelse         },
-    {   "while",        TOKwhile        },
-    {   "for",          TOKfor          },
-    {   "do",           TOKdo           },
-    {   "switch",       TOKswitch       },
-    {   "case",         TOKcase         },
-    {   "default",      TOKdefault      },
-    {   "break",        TOKbreak        },
-    {   "continue",     TOKcontinue     },
-    {   "synchronized", TOKsynchronized },
-    {   "return",       TOKreturn       },
-    {   "goto",         TOKgoto         },
-    {   "try",          TOKtry          },
-    {   "catch",        TOKcatch        },
-    {   "finally",      TOKfinally      },
-    {   "with",         TOKwith         },
-    {   "asm",          TOKasm          },
-    {   "foreach",      TOKforeach      },
-    {   "foreach_reverse",      TOKforeach_reverse      },
-    {   "scope",        TOKscope        },
-
-    {   "struct",       TOKstruct       },
-    {   "class",        TOKclass        },
-    {   "interface",    TOKinterface    },
-    {   "union",        TOKunion        },
-    {   "enum",         TOKenum         },
-    {   "import",       TOKimport       },
-    {   "mixin",        TOKmixin        },
-    {   "static",       TOKstatic       },
-    {   "final",        TOKfinal        },
-    {   "const",        TOKconst        },
-    {   "typedef",      TOKtypedef      },
-    {   "alias",        TOKalias        },
-    {   "override",     TOKoverride     },
-    {   "abstract",     TOKabstract     },
-    {   "volatile",     TOKvolatile     },
-    {   "debug",        TOKdebug        },
-    {   "deprecated",   TOKdeprecated   },
-    {   "in",           TOKin           },
-    {   "out",          TOKout          },
-    {   "inout",        TOKinout        },
-    {   "lazy",         TOKlazy         },
-    {   "auto",         TOKauto         },
-
-    {   "align",        TOKalign        },
-    {   "extern",       TOKextern       },
-    {   "private",      TOKprivate      },
-    {   "package",      TOKpackage      },
-    {   "protected",    TOKprotected    },
-    {   "public",       TOKpublic       },
-    {   "export",       TOKexport       },
-
-    {   "body",         TOKbody         },
-    {   "invariant",    TOKinvariant    },
-    {   "unittest",     TOKunittest     },
-    {   "version",      TOKversion      },
-
-    {   "__argTypes",   TOKargTypes     },
-    {   "__parameters", TOKparameters   },
-    {   "ref",          TOKref          },
-    {   "macro",        TOKmacro        },
-
-    {   "pure",         TOKpure         },
-    {   "nothrow",      TOKnothrow      },
-    {   "__gshared",    TOKgshared      },
-    {   "__traits",     TOKtraits       },
-    {   "__vector",     TOKvector       },
-    {   "__overloadset", TOKoverloadset },
-    {   "__FILE__",     TOKfile         },
-    {   "__LINE__",     TOKline         },
-    {   "__MODULE__",   TOKmodulestring },
-    {   "__FUNCTION__", TOKfuncstring   },
-    {   "__PRETTY_FUNCTION__", TOKprettyfunc   },
-    {   "shared",       TOKshared       },
-    {   "immutable",    TOKimmutable    },
-    {   NULL,           TOKreserved     }
-};
-
 int Token::isKeyword()
 {
-    for (size_t u = 0; u < nkeywords; u++)
+    for (size_t u = 0; u < NKEYWORDS; u++)
     {
         if (keywords[u].value == value)
             return 1;
@@ -2848,19 +3139,38 @@ int Token::isKeyword()
     return 0;
 }
 
+/****************************************
+ * Set the values of __DATE__, __TIME__ and __TIMESTAMP__ to now.
+ */
+
+void Lexer::initDateTime()
+{
+    time_t ct;
+    ::time(&ct);
+    char *p = ctime(&ct);
+    assert(p);
+    sprintf(&datestr[0], "%.6s %.4s", p + 4, p + 20);
+    sprintf(&timestr[0], "%.8s", p + 11);
+    sprintf(&timestampstr[0], "%.24s", p);
+}
+
 void Lexer::initKeywords()
 {
     stringtable._init(6151);
+    literals._init();
 
     cmtable_init();
+    initDateTime();
 
-    for (nkeywords = 0; keywords[nkeywords].name; nkeywords++)
+    for (size_t u = 0; u < NKEYWORDS; u++)
     {
         //printf("keyword[%d] = '%s'\n",u, keywords[u].name);
-        const char *s = keywords[nkeywords].name;
-        TOK v = keywords[nkeywords].value;
-        StringValue *sv = stringtable.insert(s, strlen(s));
-        sv->ptrvalue = (char *)new Identifier(sv->toDchars(),v);
+        const char *s = keywords[u].name;
+        TOK v = keywords[u].value;
+        StringValue *sv = stringtable.insert(s, keywords[u].len);
+        keywords[u].ident = new Identifier(sv->toDchars(),v);
+        sv->ptrvalue = (char *)keywords[u].ident;
+        assert(lookupKeyword((const utf8_t *)s, keywords[u].len) == &keywords[u]);
 
         //printf("tochars[%d] = '%s'\n",v, s);
         Token::tochars[v] = s;
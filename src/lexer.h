@@ -218,7 +218,6 @@ struct Token
     };
 
     static const char *tochars[TOKMAX];
-    static void *operator new(size_t sz);
 
     Token() : next(NULL) {}
     int isKeyword();
@@ -233,8 +232,10 @@ class Lexer
 {
 public:
     static StringTable stringtable;
-    static OutBuffer stringbuffer;
-    static Token *freelist;
+    static StringTable literals;        // payloads of string literals
+    static bool threaded;       // lexers may be running on worker threads
+
+    OutBuffer stringbuffer;
 
     Loc scanloc;                // for error messages
 
@@ -247,13 +248,30 @@ public:
     int doDocComment;           // collect doc comment information
     int anyToken;               // !=0 means seen at least one token
     int commentToken;           // !=0 means comments are TOKcomment's
+    int gagErrors;              // !=0 means count diagnostics instead of reporting them
+    unsigned gaggedErrors;      // number of diagnostics counted while gagged
+    Token *lexed;               // tokens from scanAll() for scan() to replay
+
+    /* The tokens peek()ed past token, oldest first. They are taken in
+     * order from a ring buffer, and from a free list of spares if the
+     * ring is full.
+     */
+    Token *ahead;               // ring buffer of LOOKAHEAD tokens, NULL until needed
+    unsigned aheadStart;        // index of the oldest in ahead[]
+    unsigned aheadDim;          // number of ahead[] in use
+    Token *spare;               // unused tokens from beyond the ring
 
     Lexer(Module *mod,
         const utf8_t *base, size_t begoffset, size_t endoffset,
         int doDocComment, int commentToken);
+    ~Lexer();
 
     static void initKeywords();
+    static void initDateTime();
     static Identifier *idPool(const char *s);
+    static Identifier *idPool(const char *s, size_t len);
+    static utf8_t *literalPool(const utf8_t *s, size_t len);
+    static int uniqueIdCount;           // last number used by uniqueId(s)
     static Identifier *uniqueId(const char *s);
     static Identifier *uniqueId(const char *s, int num);
 
@@ -261,8 +279,11 @@ public:
     TOK peekNext();
     TOK peekNext2();
     void scan(Token *t);
+    Token *scanAll();
     Token *peek(Token *t);
     Token *peekPastParen(Token *t);
+    Token *allocToken();
+    void freeToken(Token *t);
     unsigned escapeSequence();
     TOK wysiwygStringConstant(Token *t, int tc);
     TOK hexStringConstant(Token *t);
@@ -107,7 +107,7 @@ void LibElf::setFilename(const char *dir, const char *filename)
 
     libfile = new File(libfilename);
 
-    loc.filename = libfile->name->toChars();
+    loc.setFilename(libfile->name->toChars());
     loc.linnum = 0;
     loc.charnum = 0;
 }
@@ -314,7 +314,7 @@ void LibElf::addObject(const char *module_name, void *buf, size_t buflen)
     {   assert(module_name[0]);
         FileName f((char *)module_name);
         File file(&f);
-        readFile(Loc(), &file);
+        mapFile(Loc(), &file);
         buf = file.buffer;
         buflen = file.len;
         file.ref = 1;
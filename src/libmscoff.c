@@ -133,7 +133,7 @@ void LibMSCoff::setFilename(const char *dir, const char *filename)
 
     libfile = new File(libfilename);
 
-    loc.filename = libfile->name->toChars();
+    loc.setFilename(libfile->name->toChars());
     loc.linnum = 0;
     loc.charnum = 0;
 }
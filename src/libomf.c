@@ -67,7 +67,7 @@ class LibOMF : public Library
         Loc loc;
         if (libfile)
         {
-            loc.filename = libfile->name->toChars();
+            loc.setFilename(libfile->name->toChars());
             loc.linnum = 0;
             loc.charnum = 0;
         }
@@ -113,7 +113,7 @@ void LibOMF::setFilename(const char *dir, const char *filename)
 
     libfile = new File(libfilename);
 
-    loc.filename = libfile->name->toChars();
+    loc.setFilename(libfile->name->toChars());
     loc.linnum = 0;
     loc.charnum = 0;
 }
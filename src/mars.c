@@ -18,11 +18,21 @@
 
 #if __linux__ || __APPLE__ || __FreeBSD__ || __OpenBSD__ || __sun
 #include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if __GLIBC__
+#include <malloc.h>     // mallopt()
 #endif
 
 #include "rmem.h"
 #include "root.h"
 #include "async.h"
+#include "thread.h"
+#include "stringtable.h"
 #include "target.h"
 
 #include "mars.h"
@@ -36,9 +46,13 @@
 #include "lib.h"
 #include "json.h"
 #include "declaration.h"
+#include "template.h"
 #include "hdrgen.h"
 #include "doc.h"
 #include "color.h"
+#include "server.h"
+#include "timetrace.h"
+#include "memstats.h"
 
 bool response_expand(size_t *pargc, const char ***pargv);
 void browse(const char *url);
@@ -180,13 +194,54 @@ void Global::increaseErrorCount()
 }
 
 
+const char **Loc::fileblocks[Loc::FILEBLOCKS];
+static StringTable *filenames;          // the index of each file name
+static unsigned nfilenames = 1;         // 0 is for no file name
+static Mutex filenamesLock;             // Lexers set file names on worker threads
+
+/**************************************
+ * Set the file name, interning it.
+ */
+
+void Loc::setFilename(const char *filename)
+{
+    if (!filename)
+    {
+        filenum = 0;
+        return;
+    }
+    filenamesLock.lock();
+    if (!filenames)
+    {
+        filenames = new StringTable();
+        filenames->_init();
+    }
+    StringValue *sv = filenames->update(filename, strlen(filename));
+    if (!sv->ptrvalue)
+    {
+        if (nfilenames == FILEBLOCKSIZE * FILEBLOCKS)
+        {
+            filenamesLock.unlock();
+            ::error(Loc(), "more than %u file names", nfilenames - 1);
+            fatal();
+        }
+        const char **&block = fileblocks[nfilenames / FILEBLOCKSIZE];
+        if (!block)
+            block = (const char **)mem.malloc(FILEBLOCKSIZE * sizeof(const char *));
+        block[nfilenames % FILEBLOCKSIZE] = sv->toDchars();
+        sv->ptrvalue = (void *)(size_t)nfilenames++;
+    }
+    filenum = (unsigned)(size_t)sv->ptrvalue;
+    filenamesLock.unlock();
+}
+
 char *Loc::toChars()
 {
     OutBuffer buf;
 
-    if (filename)
+    if (filenum)
     {
-        buf.printf("%s", filename);
+        buf.printf("%s", filename());
     }
 
     if (linnum)
@@ -203,13 +258,14 @@ Loc::Loc(Module *mod, unsigned linnum, unsigned charnum)
 {
     this->linnum = linnum;
     this->charnum = charnum;
-    this->filename = mod ? mod->srcfile->toChars() : NULL;
+    setFilename(mod ? mod->srcfile->toChars() : NULL);
 }
 
 bool Loc::equals(const Loc& loc)
 {
     return (!global.params.showColumns || charnum == loc.charnum) &&
-        linnum == loc.linnum && FileName::equals(filename, loc.filename);
+        linnum == loc.linnum &&
+        (filenum == loc.filenum || FileName::equals(filename(), loc.filename()));
 }
 
 /**************************************
@@ -226,7 +282,7 @@ void error(Loc loc, const char *format, ...)
 
 void error(const char *filename, unsigned linnum, unsigned charnum, const char *format, ...)
 {   Loc loc;
-    loc.filename = (char *)filename;
+    loc.setFilename(filename);
     loc.linnum = linnum;
     loc.charnum = charnum;
     va_list ap;
@@ -329,12 +385,15 @@ void vwarning(Loc loc, const char *format, va_list ap)
         if (global.params.warnings == 1)
             global.warnings++;  // warnings don't count if gagged
     }
+    else if (global.gag)
+        global.gaggedWarnings++;
 }
 
 void vdeprecation(Loc loc, const char *format, va_list ap,
                 const char *p1, const char *p2)
 {
     static const char *header = "Deprecation: ";
+    global.deprecations++;
     if (global.params.useDeprecated == 0)
         verror(loc, format, ap, p1, p2, header);
     else if (global.params.useDeprecated == 2 && !global.gag)
@@ -350,6 +409,21 @@ void readFile(Loc loc, File *f)
     }
 }
 
+/*********************************
+ * Same as readFile(), but map the file rather than read it where possible.
+ * Windows won't write a file that is mapped, so only use it for files
+ * that can't be an output on Windows.
+ */
+
+void mapFile(Loc loc, File *f)
+{
+    if (f->mmread())
+    {
+        error(loc, "Error reading file '%s'", f->name->toChars());
+        fatal();
+    }
+}
+
 void writeFile(Loc loc, File *f)
 {
     if (f->write())
@@ -422,6 +496,7 @@ Usage:\n\
   @cmdfile       read arguments from cmdfile\n\
   -allinst       generate code for all template instantiations\n\
   -c             do not link\n\
+  -client=socket run the rest of the command line on the compile server\n\
   -color[=on|off]   force colored console output on or off\n\
   -cov           do code coverage analysis\n\
   -cov=nnn       require at least nnn%% code coverage\n\
@@ -438,6 +513,8 @@ Usage:\n\
   -defaultlib=name  set default library to name\n\
   -deps          print module dependencies (imports/file/version/debug/lib)\n\
   -deps=filename write module dependencies to filename (only imports)\n%s\
+  -ftime-trace   write Chrome trace of time and memory used by each phase\n\
+  -ftime-trace=filename   write the trace to filename\n\
   -g             add symbolic debug info\n\
   -gc            add symbolic debug info, optimize for non D debuggers\n\
   -gs            always emit stack frame\n\
@@ -449,7 +526,9 @@ Usage:\n\
   -Ipath         where to look for imports\n\
   -ignore        ignore unsupported pragmas\n\
   -inline        do function inlining\n\
+  -j=N           lex on N threads, generate object files in N processes\n\
   -Jpath         where to look for string imports\n\
+  -lazybodies    parse function bodies of imports only when needed\n\
   -Llinkerflag   pass linkerflag to link\n\
   -lib           generate library rather than object files\n\
   -m32           generate 32 bit code\n\
@@ -468,12 +547,14 @@ Usage:\n\
   -property      enforce property syntax\n\
   -release       compile release version\n\
   -run srcfile args...   run resulting program, passing args\n\
+  -server=socket run as compile server, listening on socket\n\
   -shared        generate shared library (DLL)\n\
   -transition=id show additional info about language change identified by 'id'\n\
   -transition=?  list all language changes\n\
   -unittest      compile in unit tests\n\
   -v             verbose\n\
   -vcolumns      print character (column) numbers in diagnostics\n\
+  -vmem          report the number and size of AST nodes of each class\n\
   -version=level compile in version code >= level\n\
   -version=ident compile in version code identified by ident\n\
   -vtls          list all variables going into thread local storage\n\
@@ -535,6 +616,188 @@ void genCmain(Scope *sc)
     rootHasMain = sc->module;
 }
 
+/************************************
+ * TaskPool task to lex root module i ahead of the parser.
+ * arg is the Modules array.
+ */
+
+static AsyncRead *lexAsyncRead;
+
+static void lexTask(void *arg, size_t i)
+{
+    Module *m = (*(Modules *)arg)[i];
+    if (lexAsyncRead && lexAsyncRead->read(i))
+        return;                 // read error is reported by the parse loop
+    m->lexAhead();
+}
+
+/************************************
+ * Generate the object file for root module m when it is not
+ * going into a single object file.
+ */
+
+static void genObjFile(Module *m, Library *library)
+{
+    if (global.params.verbose)
+        fprintf(global.stdmsg, "code      %s\n", m->toChars());
+
+    obj_start(m->srcfile->toChars());
+    m->genobjfile(global.params.multiobj);
+    if (entrypoint && m == rootHasMain)
+        entrypoint->genobjfile(global.params.multiobj);
+    for (size_t j = 0; j < Module::amodules.dim; j++)
+    {
+        Module *mx = Module::amodules[j];
+        if (mx != m && mx->importedFrom == m && (mx->marray || mx->massert || mx->munittest))
+            mx->genhelpers(true);
+    }
+    obj_end(library, m->objfile);
+    obj_write_deferred(library);
+
+    if (global.errors && !global.params.lib)
+        m->deleteObjFile();
+}
+
+#if __linux__ || __APPLE__ || __FreeBSD__ || __OpenBSD__ || __sun
+/************************************
+ * Generate the object files for modules in up to global.params.jobs
+ * child processes at a time.
+ * The back end keeps its state in globals, so rather than threads
+ * each child gets its own copy of the fully analyzed program from
+ * fork(), writes one object file and exits. Only for when each
+ * module's object file is all the parent needs back; not for -lib
+ * or -multiobj, which collect objects and file names in memory,
+ * nor for -v, whose output would come out interleaved, nor for
+ * -ftime-trace, which records each function's code generation here.
+ */
+
+static void genObjFilesForked(Modules *modules)
+{
+    /* A child that only reported errors exits with EXIT_ERRORS, and
+     * one that called fatal() with EXIT_FAILURE. A fatal error stops
+     * the compile, as it would without children: no more are started,
+     * and the running ones are killed. Each child's diagnostics go to
+     * a file, and are passed on once it has exited, except from those
+     * that were stopped, so an error they all run into is reported once.
+     */
+    const int EXIT_ERRORS = 2;
+
+    pid_t *pids = (pid_t *)mem.calloc(modules->dim, sizeof(pid_t));
+    FILE **outs = (FILE **)mem.calloc(modules->dim, sizeof(FILE *));
+    size_t running = 0;
+    size_t i = 0;
+    bool stopping = false;
+
+    fflush(NULL);               // don't have children flush our buffers too
+    while ((i < modules->dim && !stopping) || running)
+    {
+        if (i < modules->dim && !stopping && running < global.params.jobs)
+        {
+            Module *m = (*modules)[i];
+            FILE *out = tmpfile();
+            pid_t pid = fork();
+            if (pid == 0)
+            {
+                if (out)
+                    dup2(fileno(out), STDERR_FILENO);
+                genObjFile(m, NULL);
+                fflush(NULL);
+                _exit(global.errors ? EXIT_ERRORS : EXIT_SUCCESS);
+            }
+            if (pid == -1)
+            {
+                if (out)
+                    fclose(out);
+                // Do it here instead
+                genObjFile(m, NULL);
+                fflush(NULL);
+            }
+            else
+            {
+                pids[i] = pid;
+                outs[i] = out;
+                running++;
+            }
+            i++;
+            continue;
+        }
+
+        int status;
+        pid_t pid = wait(&status);
+        if (pid == -1)
+        {
+            perror("wait");
+            fatal();
+        }
+        for (size_t j = 0; j < i; j++)
+        {
+            if (pids[j] != pid)
+                continue;
+            pids[j] = 0;
+            running--;
+            Module *m = (*modules)[j];
+            bool ok = WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+            bool relay = !stopping || (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_ERRORS);
+            if (!ok && !WIFEXITED(status))
+                m->deleteObjFile();
+            else if (!ok)
+            {
+                global.errors++;        // child reported them
+                if (WEXITSTATUS(status) != EXIT_ERRORS && !stopping)
+                {
+                    stopping = true;
+                    for (size_t k = 0; k < i; k++)
+                    {
+                        if (pids[k])
+                            kill(pids[k], SIGTERM);
+                    }
+                }
+            }
+
+            if (FILE *out = outs[j])
+            {
+                if (relay)
+                {
+                    char buf[4096];
+                    size_t n;
+                    rewind(out);
+                    while ((n = fread(buf, 1, sizeof(buf), out)) != 0)
+                        fwrite(buf, 1, n, stderr);
+                }
+                fclose(out);
+                outs[j] = NULL;
+            }
+            if (!WIFEXITED(status) && relay)
+            {
+                error(Loc(), "code generation for %s terminated by signal %d",
+                        m->toChars(), WTERMSIG(status));
+            }
+            break;
+        }
+    }
+    mem.free(outs);
+    mem.free(pids);
+}
+#endif
+
+/************************************
+ * Write the -ftime-trace file. Run at exit, so that a compile
+ * that stops on errors still gets one.
+ */
+
+static void writeTimeTrace()
+{
+    const char *name = global.params.timeTraceFile;
+    if (!name)
+    {
+        // Generate name from first obj name, as for the JSON file
+        const char *n = global.params.objfiles->dim ? (*global.params.objfiles)[0] : "dmd";
+        name = FileName::forceExt(FileName::name(n), "time.json");
+    }
+    if (!TimeTrace::write(name))
+        error(Loc(), "Error writing file '%s'", name);
+}
+
 int tryMain(size_t argc, const char *argv[])
 {
     Strings files;
@@ -727,6 +990,28 @@ int tryMain(size_t argc, const char *argv[])
                 else if (p[4])
                     goto Lerror;
             }
+            else if (memcmp(p + 1, "j=", 2) == 0)
+            {
+                // Parse:
+                //      -j=N
+                if (isdigit((utf8_t)p[3]))
+                {   long jobs;
+
+                    errno = 0;
+                    jobs = strtol(p + 3, (char **)&p, 10);
+                    if (*p || errno || jobs < 1 || jobs > 256)
+                        goto Lerror;
+                    global.params.jobs = (unsigned)jobs;
+                }
+                else
+                    goto Lerror;
+            }
+            else if (memcmp(p + 1, "server=", 7) == 0)
+            {
+                if (!p[8])
+                    goto Lnoarg;
+                global.params.server = p + 8;
+            }
             else if (strcmp(p + 1, "shared") == 0)
                 global.params.dll = true;
             else if (strcmp(p + 1, "dylib") == 0)
@@ -746,6 +1031,21 @@ int tryMain(size_t argc, const char *argv[])
                 goto Lerror;
 #endif
             }
+            else if (memcmp(p + 1, "ftime-trace", 11) == 0)
+            {
+                // Parse:
+                //      -ftime-trace
+                //      -ftime-trace=filename
+                global.params.timeTrace = true;
+                if (p[12] == '=')
+                {
+                    if (!p[13])
+                        goto Lnoarg;
+                    global.params.timeTraceFile = p + 13;
+                }
+                else if (p[12])
+                    goto Lerror;
+            }
             else if (strcmp(p + 1, "map") == 0)
                 global.params.map = true;
             else if (strcmp(p + 1, "multiobj") == 0)
@@ -774,6 +1074,8 @@ int tryMain(size_t argc, const char *argv[])
                 global.params.vtls = true;
             else if (strcmp(p + 1, "vcolumns") == 0)
                 global.params.showColumns = true;
+            else if (strcmp(p + 1, "vmem") == 0)
+                global.params.vmem = true;
             else if (strcmp(p + 1, "vgc") == 0)
                 global.params.vgc = true;
             else if (memcmp(p + 1, "transition", 10) == 0)
@@ -940,6 +1242,8 @@ Language changes listed by -transition=id:\n\
                 global.params.useInline = true;
             else if (strcmp(p + 1, "lib") == 0)
                 global.params.lib = true;
+            else if (strcmp(p + 1, "lazybodies") == 0)
+                global.params.lazyBodies = true;
             else if (strcmp(p + 1, "nofloat") == 0)
                 global.params.nofloat = true;
             else if (strcmp(p + 1, "quiet") == 0)
@@ -1183,7 +1487,15 @@ Language changes listed by -transition=id:\n\
     {
         fatal();
     }
-    if (files.dim == 0)
+    if (global.params.server)
+    {
+        if (files.dim)
+        {
+            error(Loc(), "source files cannot be given to -server");
+            fatal();
+        }
+    }
+    else if (files.dim == 0)
     {   usage();
         return EXIT_FAILURE;
     }
@@ -1305,8 +1617,13 @@ Language changes listed by -transition=id:\n\
     VersionCondition::addPredefinedGlobalIdent("D_HardFloat");
 
     // Initialization
-    Type::init();
-    Id::initialize();
+    if (CompileServer::keepTypes())
+        Lexer::initDateTime();
+    else
+    {
+        Type::init();
+        Id::initialize();
+    }
     Module::init();
     Target::init();
     Expression::init();
@@ -1320,6 +1637,16 @@ Language changes listed by -transition=id:\n\
         fprintf(global.stdmsg, "config    %s\n", inifilename ? inifilename : "(none)");
     }
 
+    if (global.params.server)
+        return CompileServer::serve(global.params.server);
+
+    if (global.params.timeTrace)
+    {
+        TimeTrace::start();
+        atexit(&writeTimeTrace);
+    }
+    MemStats::enabled = global.params.vmem;
+
     //printf("%d source files\n",files.dim);
 
     // Build import search path
@@ -1519,7 +1846,12 @@ Language changes listed by -transition=id:\n\
         Module *m = modules[i];
         aw->addFile(m->srcfile);
     }
-    aw->start();
+    aw->start(global.params.jobs > 1 ? global.params.jobs : 1);
+
+    /* Keep the threads for the imports the parser comes across, until
+     * semantic is done with them.
+     */
+    Module::prefetcher = aw;
 #else
     // Single threaded
     for (size_t i = 0; i < modules.dim; i++)
@@ -1529,7 +1861,30 @@ Language changes listed by -transition=id:\n\
     }
 #endif
 
+    /* With -inline every imported function body is needed for
+     * semantic3, so don't bother putting it off.
+     */
+    Module::lazyBodies = global.params.lazyBodies && !global.params.useInline;
+
+    /* With -j=N, lex the files on N threads ahead of the parser.
+     * Parsing itself stays on this thread, in command line order, so
+     * generated names and diagnostics come out the same as without -j.
+     */
+    TaskPool *lexpool = NULL;
+    Modules lexmodules;         // modules.dim may shrink below
+    if (global.params.jobs > 1 && modules.dim > 1)
+    {
+        lexmodules.append(&modules);
+        lexpool = TaskPool::create(global.params.jobs, modules.dim, &lexTask, &lexmodules);
+#if ASYNCREAD
+        lexAsyncRead = aw;
+#endif
+        Lexer::threaded = true;
+        lexpool->start();
+    }
+
     // Parse files
+    size_t tt = TimeTrace::begin("phase", "parse");
     bool anydocfiles = false;
     size_t filecount = modules.dim;
     for (size_t filei = 0, modi = 0; filei < filecount; filei++, modi++)
@@ -1542,12 +1897,16 @@ Language changes listed by -transition=id:\n\
         m->importedFrom = m;    // m->isRoot() == true
         if (!global.params.oneobj || modi == 0 || m->isDocFile)
             m->deleteObjFile();
+        if (lexpool)
+            lexpool->wait(filei);
 #if ASYNCREAD
+        size_t ttread = TimeTrace::begin("module", "read");
         if (aw->read(filei))
         {
             error(Loc(), "cannot read file %s", m->srcfile->name->toChars());
             fatal();
         }
+        TimeTrace::end(ttread, m);
 #endif
         m->parse();
         if (m->isDocFile)
@@ -1573,9 +1932,14 @@ Language changes listed by -transition=id:\n\
                 global.params.link = false;
         }
     }
-#if ASYNCREAD
-    AsyncRead::dispose(aw);
-#endif
+    if (lexpool)
+    {
+        TaskPool::dispose(lexpool);
+        Lexer::threaded = false;
+    }
+    TimeTrace::end(tt);
+    if (global.params.vmem)
+        MemStats::report("after parse");
 
     if (anydocfiles && modules.dim &&
         (global.params.oneobj || global.params.objname))
@@ -1592,6 +1956,7 @@ Language changes listed by -transition=id:\n\
          * line switches and what else is imported, they are generated
          * before any semantic analysis.
          */
+        tt = TimeTrace::begin("phase", "header generation");
         for (size_t i = 0; i < modules.dim; i++)
         {
             Module *m = modules[i];
@@ -1599,11 +1964,13 @@ Language changes listed by -transition=id:\n\
                 fprintf(global.stdmsg, "import    %s\n", m->toChars());
             genhdrfile(m);
         }
+        TimeTrace::end(tt);
     }
     if (global.errors)
         fatal();
 
     // load all unconditional imports for better symbol resolving
+    tt = TimeTrace::begin("phase", "importAll");
     for (size_t i = 0; i < modules.dim; i++)
     {
        Module *m = modules[i];
@@ -1611,12 +1978,14 @@ Language changes listed by -transition=id:\n\
            fprintf(global.stdmsg, "importall %s\n", m->toChars());
        m->importAll(NULL);
     }
+    TimeTrace::end(tt);
     if (global.errors)
         fatal();
 
     backend_init();
 
     // Do semantic analysis
+    tt = TimeTrace::begin("phase", "semantic1");
     for (size_t i = 0; i < modules.dim; i++)
     {
         Module *m = modules[i];
@@ -1624,12 +1993,15 @@ Language changes listed by -transition=id:\n\
             fprintf(global.stdmsg, "semantic  %s\n", m->toChars());
         m->semantic();
     }
+    TimeTrace::end(tt);
     if (global.errors)
         fatal();
 
     Module::dprogress = 1;
-    Module::runDeferredSemantic();
-    if (Module::deferred.dim)
+    tt = TimeTrace::begin("phase", "deferred semantic");
+    Module::runDeferredSemantic(true);
+    TimeTrace::end(tt);
+    if (Module::numDeferred())
     {
         for (size_t i = 0; i < Module::deferred.dim; i++)
         {
@@ -1640,6 +2012,7 @@ Language changes listed by -transition=id:\n\
     }
 
     // Do pass 2 semantic analysis
+    tt = TimeTrace::begin("phase", "semantic2");
     for (size_t i = 0; i < modules.dim; i++)
     {
         Module *m = modules[i];
@@ -1647,10 +2020,12 @@ Language changes listed by -transition=id:\n\
             fprintf(global.stdmsg, "semantic2 %s\n", m->toChars());
         m->semantic2();
     }
+    TimeTrace::end(tt);
     if (global.errors)
         fatal();
 
     // Do pass 3 semantic analysis
+    tt = TimeTrace::begin("phase", "semantic3");
     for (size_t i = 0; i < modules.dim; i++)
     {
         Module *m = modules[i];
@@ -1676,7 +2051,27 @@ Language changes listed by -transition=id:\n\
         if (global.errors)
             fatal();
     }
+    TimeTrace::end(tt);
+    tt = TimeTrace::begin("phase", "deferred semantic3");
     Module::runDeferredSemantic3();
+    TimeTrace::end(tt);
+    if (global.params.vmem)
+        MemStats::report("after semantic");
+    if (global.params.verbose)
+    {
+        fprintf(global.stdmsg, "dircache  %llu directories listed, %llu stat calls saved\n",
+            (unsigned long long)FileName::dirsListed, (unsigned long long)FileName::statsSaved);
+        fprintf(global.stdmsg, "deferred  %llu semantic runs on deferred symbols\n",
+            (unsigned long long)Module::deferredRuns);
+        fprintf(global.stdmsg, "lookups   %llu searches of imports, %llu of them cached\n",
+            (unsigned long long)ScopeDsymbol::importSearches, (unsigned long long)ScopeDsymbol::importSearchHits);
+        fprintf(global.stdmsg, "templates %llu instance lookups, %llu probes\n",
+            (unsigned long long)TemplateDeclaration::instanceLookups, (unsigned long long)TemplateDeclaration::instanceProbes);
+        fprintf(global.stdmsg, "deduction %llu function template matches, %llu of them cached\n",
+            (unsigned long long)TemplateDeclaration::deductionLookups, (unsigned long long)TemplateDeclaration::deductionHits);
+        fprintf(global.stdmsg, "convs     %llu implicit conversions of types, %llu of them cached\n",
+            (unsigned long long)Type::convLookups, (unsigned long long)Type::convHits);
+    }
     if (global.errors)
         fatal();
 
@@ -1696,6 +2091,7 @@ Language changes listed by -transition=id:\n\
     // Scan for functions to inline
     if (global.params.useInline)
     {
+        tt = TimeTrace::begin("phase", "inline scan");
         for (size_t i = 0; i < modules.dim; i++)
         {
             Module *m = modules[i];
@@ -1703,6 +2099,7 @@ Language changes listed by -transition=id:\n\
                 fprintf(global.stdmsg, "inline scan %s\n", m->toChars());
             inlineScan(m);
         }
+        TimeTrace::end(tt);
     }
 
     // Do not attempt to generate output files if errors or warnings occurred
@@ -1729,6 +2126,7 @@ Language changes listed by -transition=id:\n\
 
     if (global.params.doJsonGeneration)
     {
+        tt = TimeTrace::begin("phase", "json");
         OutBuffer buf;
         json_generate(&buf, &modules);
 
@@ -1771,17 +2169,31 @@ Language changes listed by -transition=id:\n\
             jsonfile->ref = 1;
             writeFile(Loc(), jsonfile);
         }
+        TimeTrace::end(tt);
     }
 
     if (!global.errors && global.params.doDocComments)
     {
+        tt = TimeTrace::begin("phase", "doc");
         for (size_t i = 0; i < modules.dim; i++)
         {
             Module *m = modules[i];
             gendocfile(m);
         }
+        TimeTrace::end(tt);
     }
 
+    /* Every import has been loaded by now. Don't leave the threads
+     * around for -j to fork.
+     */
+    if (Module::prefetcher)
+    {
+        AsyncRead::dispose(Module::prefetcher);
+        Module::prefetcher = NULL;
+    }
+
+    tt = TimeTrace::begin("phase", "codegen");
+
     if (!global.params.obj)
     {
     }
@@ -1809,36 +2221,25 @@ Language changes listed by -transition=id:\n\
             obj_end(library, modules[0]->objfile);
         }
     }
+#if __linux__ || __APPLE__ || __FreeBSD__ || __OpenBSD__ || __sun
+    else if (global.params.jobs > 1 && modules.dim > 1 &&
+        !library && !global.params.multiobj && !global.params.verbose &&
+        !global.params.timeTrace)
+    {
+        genObjFilesForked(&modules);
+    }
+#endif
     else
     {
         for (size_t i = 0; i < modules.dim; i++)
-        {
-            Module *m = modules[i];
-            if (global.params.verbose)
-                fprintf(global.stdmsg, "code      %s\n", m->toChars());
-
-            obj_start(m->srcfile->toChars());
-            m->genobjfile(global.params.multiobj);
-            if (entrypoint && m == rootHasMain)
-                entrypoint->genobjfile(global.params.multiobj);
-            for (size_t j = 0; j < Module::amodules.dim; j++)
-            {
-                Module *mx = Module::amodules[j];
-                if (mx != m && mx->importedFrom == m && (mx->marray || mx->massert || mx->munittest))
-                    mx->genhelpers(true);
-            }
-            obj_end(library, m->objfile);
-            obj_write_deferred(library);
-
-            if (global.errors && !global.params.lib)
-                m->deleteObjFile();
-        }
+            genObjFile(modules[i], library);
     }
 
     if (global.params.lib && !global.errors)
         library->write();
 
     backend_term();
+    TimeTrace::end(tt);
     if (global.errors)
         fatal();
 
@@ -1851,7 +2252,11 @@ Language changes listed by -transition=id:\n\
     else
     {
         if (global.params.link)
+        {
+            tt = TimeTrace::begin("phase", "link");
             status = runLINK();
+            TimeTrace::end(tt);
+        }
 
         if (global.params.run)
         {
@@ -1879,6 +2284,28 @@ int main(int argc, const char *argv[])
 {
     int status = -1;
 
+#if __GLIBC__
+    /* Freeing a big block, such as the array a StringTable outgrows,
+     * makes glibc raise its mmap threshold and serve later big requests,
+     * operator new's chunks among them, from its heap. Keep it fixed.
+     */
+    mallopt(M_MMAP_THRESHOLD, 128 * 1024);
+#endif
+
+    /* -client=socket sends the rest of the command line to the
+     * compile server, or compiles it here if there is none.
+     */
+    if (argc > 1 && strncmp(argv[1], "-client=", 8) == 0)
+    {
+        const char *sockname = argv[1] + 8;
+        argv[1] = argv[0];
+        argc--;
+        argv++;
+        status = CompileServer::request(sockname, argc, argv);
+        if (status != -1)
+            return status;
+    }
+
     status = tryMain(argc, argv);
 
     return status;
@@ -96,6 +96,7 @@ struct Param
     bool verbose;       // verbose compile
     bool showColumns;   // print character (column) numbers in diagnostics
     bool vtls;          // identify thread local variables
+    bool vmem;          // report memory used by AST nodes
     char vgc;           // identify gc usage
     bool vfield;        // identify non-mutable field variables
     char symdebug;      // insert debug symbolic information
@@ -133,12 +134,14 @@ struct Param
     bool color;         // use ANSI colors in console output
     bool cov;           // generate code coverage data
     unsigned char covPercent;   // 0..100 code coverage percentage required
+    unsigned jobs;      // number of threads to lex root modules with (-j=N)
     bool nofloat;       // code should not pull in floating point support
     bool ignoreUnsupportedPragmas;      // rather than error on them
     bool enforcePropertySyntax;
     bool betterC;       // be a "better C" compiler; no dependency on D runtime
     bool addMain;       // add a default main() function
     bool allInst;       // generate code for all template instantiations
+    bool lazyBodies;    // parse function bodies of imports only when needed
 
     const char *argv0;    // program name
     Strings *imppath;     // array of char*'s of where to look for import modules
@@ -146,6 +149,7 @@ struct Param
     const char *objdir;   // .obj/.lib file output directory
     const char *objname;  // .obj file output name
     const char *libname;  // .lib file output name
+    const char *server;   // run as compile server listening on this socket
 
     bool doDocComments;  // process embedded documentation comments
     const char *docdir;  // write documentation file to docdir directory
@@ -159,6 +163,9 @@ struct Param
     bool doJsonGeneration;    // write JSON file
     const char *jsonfilename; // write JSON file to jsonfilename
 
+    bool timeTrace;            // write Chrome trace of phase times (-ftime-trace)
+    const char *timeTraceFile; // write it to timeTraceFile
+
     unsigned debuglevel;   // debug level
     Strings *debugids;     // debug identifiers
 
@@ -242,6 +249,8 @@ struct Global
     FILE *stdmsg;          // where to send verbose messages
     unsigned gag;          // !=0 means gag reporting of errors & warnings
     unsigned gaggedErrors; // number of errors reported while gagged
+    unsigned gaggedWarnings; // number of warnings reported while gagged
+    unsigned deprecations; // number of deprecations reported so far, gagged or not
 
     /* Gagging can either be speculative (is(typeof()), etc)
      * or because of forward references
@@ -312,21 +321,41 @@ typedef longdouble real_t;
 class Module;
 
 //typedef unsigned Loc;         // file location
+/* The file name is interned, so that a Loc takes 12 bytes rather than 16,
+ * and fits alongside a 4 byte field in the AST nodes.
+ */
 struct Loc
 {
-    const char *filename;
     unsigned linnum;
     unsigned charnum;
+    unsigned filenum;           // index of the file name, 0 for none
+
+    enum
+    {
+        FILEBLOCKSIZE = 1024,
+        FILEBLOCKS = 4096,
+    };
+
+    /* The interned file names. They are in blocks that never move, so
+     * that one thread can read them while another adds to them.
+     */
+    static const char **fileblocks[FILEBLOCKS];
 
     Loc()
     {
         linnum = 0;
         charnum = 0;
-        filename = NULL;
+        filenum = 0;
     }
 
     Loc(Module *mod, unsigned linnum, unsigned charnum);
 
+    const char *filename() const
+    {
+        return filenum ? fileblocks[filenum / FILEBLOCKSIZE][filenum % FILEBLOCKSIZE] : NULL;
+    }
+    void setFilename(const char *filename);
+
     char *toChars();
     bool equals(const Loc& loc);
 };
@@ -405,6 +434,7 @@ void obj_append(Dsymbol *s);
 void obj_write_deferred(Library *library);
 
 void readFile(Loc loc, File *f);
+void mapFile(Loc loc, File *f);
 void writeFile(Loc loc, File *f);
 void ensurePathToNameExists(Loc loc, const char *name);
 
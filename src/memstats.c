@@ -0,0 +1,298 @@
+
+/* Compiler implementation of the D programming language
+ * Copyright (c) 1999-2014 by Digital Mars
+ * All Rights Reserved
+ * written by Walter Bright
+ * http://www.digitalmars.com
+ * Distributed under the Boost Software License, Version 1.0.
+ * http://www.boost.org/LICENSE_1_0.txt
+ * https://github.com/D-Programming-Language/dmd/blob/master/src/memstats.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "rmem.h"
+#include "root.h"
+#include "thread.h"
+
+#include "mars.h"
+#include "dsymbol.h"
+#include "expression.h"
+#include "statement.h"
+#include "mtype.h"
+#include "init.h"
+#include "visitor.h"
+#include "memstats.h"
+
+#if _WIN32
+#define THREADLOCAL __declspec(thread)
+#elif __linux__
+#define THREADLOCAL __thread
+#else
+#define THREADLOCAL                     // no worker threads, see async.c
+#endif
+
+struct NodeRecord
+{
+    void *p;
+    unsigned size;
+    unsigned kind;
+};
+
+/* The nodes allocated by one thread. Each thread adds to its own,
+ * so that release() drops only what the thread's Mem::release() freed.
+ */
+struct NodeRecords
+{
+    Mutex lock;                 // held while adding, and by report()
+    Array<NodeRecord> nodes;
+};
+
+bool MemStats::enabled = false;
+
+static THREADLOCAL NodeRecords *records;
+static Mutex threadsLock;       // guards threads
+static Array<NodeRecords *> threads;
+
+/*******************************************
+ * Allocate a node of kind, the operator new of each kind of node.
+ */
+
+void *MemStats::allocate(size_t size, NodeKind kind)
+{
+    void *p = ::operator new(size);
+    if (enabled)
+        record(p, size, kind);
+    return p;
+}
+
+/*******************************************
+ * Record the node p, of kind, taking size bytes.
+ */
+
+void MemStats::record(void *p, size_t size, NodeKind kind)
+{
+    if (!records)
+    {
+        records = new NodeRecords();
+        mem.keepRegions();      // records outlives any region
+        threadsLock.lock();
+        threads.push(records);
+        threadsLock.unlock();
+    }
+    NodeRecord r;
+    r.p = p;
+    r.size = (unsigned)size;
+    r.kind = kind;
+    records->lock.lock();
+    records->nodes.push(r);
+    records->lock.unlock();
+}
+
+/*******************************************
+ * Call alongside Mem::mark(), and when Mem::release() succeeds, release()
+ * from the result to forget the nodes it freed. Nodes recorded by this
+ * thread since to, which are not in the region, are kept.
+ */
+
+size_t MemStats::mark()
+{
+    return records ? records->nodes.dim : 0;
+}
+
+void MemStats::release(size_t from, size_t to)
+{
+    if (records && from < to)
+    {
+        records->lock.lock();
+        Array<NodeRecord> *a = &records->nodes;
+        memmove(a->data + from, a->data + to, (a->dim - to) * sizeof(NodeRecord));
+        a->setDim(a->dim - (to - from));
+        records->lock.unlock();
+    }
+}
+
+/*******************************************
+ * Find the name of a node's class.
+ */
+
+class NodeName : public Visitor
+{
+public:
+    const char *name;
+
+    NodeName() : name(NULL) {}
+
+#define X(C) void visit(C *) { name = #C; }
+    X(Statement) X(ErrorStatement) X(PeelStatement) X(ExpStatement)
+    X(DtorExpStatement) X(CompileStatement) X(CompoundStatement)
+    X(CompoundDeclarationStatement) X(UnrolledLoopStatement) X(ScopeStatement)
+    X(WhileStatement) X(DoStatement) X(ForStatement) X(ForeachStatement)
+    X(ForeachRangeStatement) X(IfStatement) X(ConditionalStatement)
+    X(PragmaStatement) X(StaticAssertStatement) X(SwitchStatement)
+    X(CaseStatement) X(CaseRangeStatement) X(DefaultStatement)
+    X(GotoDefaultStatement) X(GotoCaseStatement) X(SwitchErrorStatement)
+    X(ReturnStatement) X(BreakStatement) X(ContinueStatement)
+    X(SynchronizedStatement) X(WithStatement) X(TryCatchStatement)
+    X(TryFinallyStatement) X(OnScopeStatement) X(ThrowStatement)
+    X(DebugStatement) X(GotoStatement) X(LabelStatement) X(AsmStatement)
+    X(ImportStatement) X(Type) X(TypeError) X(TypeNext) X(TypeBasic)
+    X(TypeVector) X(TypeArray) X(TypeSArray) X(TypeDArray) X(TypeAArray)
+    X(TypePointer) X(TypeReference) X(TypeFunction) X(TypeDelegate)
+    X(TypeQualified) X(TypeIdentifier) X(TypeInstance) X(TypeTypeof)
+    X(TypeReturn) X(TypeStruct) X(TypeEnum) X(TypeTypedef) X(TypeClass)
+    X(TypeTuple) X(TypeSlice) X(TypeNull) X(Dsymbol) X(StaticAssert)
+    X(DebugSymbol) X(VersionSymbol) X(EnumMember) X(Import) X(OverloadSet)
+    X(LabelDsymbol) X(AliasThis) X(AttribDeclaration)
+    X(StorageClassDeclaration) X(DeprecatedDeclaration) X(LinkDeclaration)
+    X(ProtDeclaration) X(AlignDeclaration) X(AnonDeclaration)
+    X(PragmaDeclaration) X(ConditionalDeclaration) X(StaticIfDeclaration)
+    X(CompileDeclaration) X(UserAttributeDeclaration) X(ScopeDsymbol)
+    X(TemplateDeclaration) X(TemplateInstance) X(TemplateMixin)
+    X(EnumDeclaration) X(Package) X(Module) X(WithScopeSymbol)
+    X(ArrayScopeSymbol) X(AggregateDeclaration) X(StructDeclaration)
+    X(UnionDeclaration) X(ClassDeclaration) X(InterfaceDeclaration)
+    X(Declaration) X(TupleDeclaration) X(TypedefDeclaration)
+    X(AliasDeclaration) X(OverDeclaration) X(VarDeclaration)
+    X(SymbolDeclaration) X(ClassInfoDeclaration) X(ThisDeclaration)
+    X(TypeInfoDeclaration) X(TypeInfoStructDeclaration)
+    X(TypeInfoClassDeclaration) X(TypeInfoInterfaceDeclaration)
+    X(TypeInfoTypedefDeclaration) X(TypeInfoPointerDeclaration)
+    X(TypeInfoArrayDeclaration) X(TypeInfoStaticArrayDeclaration)
+    X(TypeInfoAssociativeArrayDeclaration) X(TypeInfoEnumDeclaration)
+    X(TypeInfoFunctionDeclaration) X(TypeInfoDelegateDeclaration)
+    X(TypeInfoTupleDeclaration) X(TypeInfoConstDeclaration)
+    X(TypeInfoInvariantDeclaration) X(TypeInfoSharedDeclaration)
+    X(TypeInfoWildDeclaration) X(TypeInfoVectorDeclaration) X(FuncDeclaration)
+    X(FuncAliasDeclaration) X(FuncLiteralDeclaration) X(CtorDeclaration)
+    X(PostBlitDeclaration) X(DtorDeclaration) X(StaticCtorDeclaration)
+    X(SharedStaticCtorDeclaration) X(StaticDtorDeclaration)
+    X(SharedStaticDtorDeclaration) X(InvariantDeclaration)
+    X(UnitTestDeclaration) X(NewDeclaration) X(DeleteDeclaration)
+    X(Initializer) X(VoidInitializer) X(ErrorInitializer) X(StructInitializer)
+    X(ArrayInitializer) X(ExpInitializer) X(Expression) X(IntegerExp)
+    X(ErrorExp) X(RealExp) X(ComplexExp) X(IdentifierExp) X(DollarExp)
+    X(DsymbolExp) X(ThisExp) X(SuperExp) X(NullExp) X(StringExp) X(TupleExp)
+    X(ArrayLiteralExp) X(AssocArrayLiteralExp) X(StructLiteralExp) X(TypeExp)
+    X(ScopeExp) X(TemplateExp) X(NewExp) X(NewAnonClassExp) X(SymbolExp)
+    X(SymOffExp) X(VarExp) X(OverExp) X(FuncExp) X(DeclarationExp)
+    X(TypeidExp) X(TraitsExp) X(HaltExp) X(IsExp) X(UnaExp) X(BinExp)
+    X(BinAssignExp) X(CompileExp) X(FileExp) X(AssertExp) X(DotIdExp)
+    X(DotTemplateExp) X(DotVarExp) X(DotTemplateInstanceExp) X(DelegateExp)
+    X(DotTypeExp) X(CallExp) X(AddrExp) X(PtrExp) X(NegExp) X(UAddExp)
+    X(ComExp) X(NotExp) X(BoolExp) X(DeleteExp) X(CastExp) X(VectorExp)
+    X(SliceExp) X(ArrayLengthExp) X(IntervalExp) X(DelegatePtrExp)
+    X(DelegateFuncptrExp) X(ArrayExp) X(DotExp) X(CommaExp) X(IndexExp)
+    X(PostExp) X(PreExp) X(AssignExp) X(ConstructExp) X(BlitExp)
+    X(AddAssignExp) X(MinAssignExp) X(MulAssignExp) X(DivAssignExp)
+    X(ModAssignExp) X(AndAssignExp) X(OrAssignExp) X(XorAssignExp)
+    X(PowAssignExp) X(ShlAssignExp) X(ShrAssignExp) X(UshrAssignExp)
+    X(CatAssignExp) X(AddExp) X(MinExp) X(CatExp) X(MulExp) X(DivExp)
+    X(ModExp) X(PowExp) X(ShlExp) X(ShrExp) X(UshrExp) X(AndExp) X(OrExp)
+    X(XorExp) X(OrOrExp) X(AndAndExp) X(CmpExp) X(InExp) X(RemoveExp)
+    X(EqualExp) X(IdentityExp) X(CondExp) X(DefaultInitExp) X(FileInitExp)
+    X(LineInitExp) X(ModuleInitExp) X(FuncInitExp) X(PrettyFuncInitExp)
+    X(ClassReferenceExp) X(VoidInitExp) X(ThrownExceptionExp)
+#undef X
+};
+
+struct ClassStats
+{
+    void *vptr;                 // identifies the class
+    void *p;                    // a node of it
+    unsigned kind;
+    const char *name;
+    size_t count;
+    size_t bytes;
+};
+
+static int cmpClassStats(const void *p1, const void *p2)
+{
+    const ClassStats *c1 = (const ClassStats *)p1;
+    const ClassStats *c2 = (const ClassStats *)p2;
+    if (c1->bytes != c2->bytes)
+        return c1->bytes < c2->bytes ? 1 : -1;
+    return strcmp(c1->name, c2->name);
+}
+
+/*******************************************
+ * Print how many nodes of each class have been allocated so far, and
+ * how many bytes they take, biggest first.
+ */
+
+void MemStats::report(const char *when)
+{
+    const size_t tabsize = 1024;        // many more than there are classes
+    ClassStats *tab = (ClassStats *)mem.calloc(tabsize, sizeof(ClassStats));
+    size_t nclasses = 0;
+    size_t count = 0;
+    size_t bytes = 0;
+
+    threadsLock.lock();
+    for (size_t i = 0; i < threads.dim; i++)
+    {
+        NodeRecords *t = threads[i];
+        t->lock.lock();
+        for (size_t j = 0; j < t->nodes.dim; j++)
+        {
+            NodeRecord *r = &t->nodes[j];
+            void *vptr = *(void **)r->p;
+            size_t h = ((size_t)vptr >> 4) & (tabsize - 1);
+            while (tab[h].vptr && tab[h].vptr != vptr)
+                h = (h + 1) & (tabsize - 1);
+            ClassStats *c = &tab[h];
+            if (!c->vptr)
+            {
+                assert(nclasses < tabsize / 2);
+                nclasses++;
+                c->vptr = vptr;
+                c->p = r->p;
+                c->kind = r->kind;
+            }
+            c->count++;
+            c->bytes += r->size;
+            count++;
+            bytes += r->size;
+        }
+        t->lock.unlock();
+    }
+    threadsLock.unlock();
+
+    // Pack the classes at the start of tab, and name them
+    size_t n = 0;
+    for (size_t h = 0; h < tabsize; h++)
+    {
+        if (!tab[h].vptr)
+            continue;
+        ClassStats *c = &tab[n++];
+        *c = tab[h];
+        NodeName v;
+        switch (c->kind)
+        {
+            case NODEdsymbol:       ((Dsymbol *)c->p)->accept(&v);      break;
+            case NODEexpression:    ((Expression *)c->p)->accept(&v);   break;
+            case NODEstatement:     ((Statement *)c->p)->accept(&v);    break;
+            case NODEtype:          ((Type *)c->p)->accept(&v);         break;
+            case NODEinitializer:   ((Initializer *)c->p)->accept(&v);  break;
+            default:                assert(0);
+        }
+        c->name = v.name;
+    }
+    qsort(tab, n, sizeof(ClassStats), &cmpClassStats);
+
+    FILE *f = global.stdmsg;
+    fprintf(f, "vmem      %s: %llu nodes in %llu bytes, %llu bytes allocated\n", when,
+        (unsigned long long)count, (unsigned long long)bytes, (unsigned long long)mem.allocated());
+    fprintf(f, "vmem      %10s %12s %6s  %s\n", "count", "bytes", "size", "class");
+    for (size_t i = 0; i < n; i++)
+    {
+        ClassStats *c = &tab[i];
+        fprintf(f, "vmem      %10llu %12llu %6llu  %s\n",
+            (unsigned long long)c->count, (unsigned long long)c->bytes,
+            (unsigned long long)(c->bytes / c->count), c->name);
+    }
+    mem.free(tab);
+}
@@ -0,0 +1,46 @@
+
+/* Compiler implementation of the D programming language
+ * Copyright (c) 1999-2014 by Digital Mars
+ * All Rights Reserved
+ * written by Walter Bright
+ * http://www.digitalmars.com
+ * Distributed under the Boost Software License, Version 1.0.
+ * http://www.boost.org/LICENSE_1_0.txt
+ * https://github.com/D-Programming-Language/dmd/blob/master/src/memstats.h
+ */
+
+#ifndef DMD_MEMSTATS_H
+#define DMD_MEMSTATS_H
+
+#ifdef __DMC__
+#pragma once
+#endif /* __DMC__ */
+
+#include <stddef.h>     // for size_t
+
+/* With -vmem, the Dsymbol, Expression, Statement, Type and Initializer
+ * nodes are recorded as they are allocated, and report() prints how
+ * many there are of each class, and how many bytes they take.
+ */
+
+enum NodeKind
+{
+    NODEdsymbol,
+    NODEexpression,
+    NODEstatement,
+    NODEtype,
+    NODEinitializer,
+};
+
+struct MemStats
+{
+    static bool enabled;
+
+    static void *allocate(size_t size, NodeKind kind);
+    static void record(void *p, size_t size, NodeKind kind);
+    static size_t mark();
+    static void release(size_t from, size_t to);
+    static void report(const char *when);
+};
+
+#endif /* DMD_MEMSTATS_H */
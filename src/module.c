@@ -13,6 +13,11 @@
 #include <stdlib.h>
 #include <assert.h>
 
+#include "rmem.h"
+#include "aav.h"
+#include "stringtable.h"
+#include "async.h"
+
 #include "mars.h"
 #include "module.h"
 #include "parse.h"
@@ -23,6 +28,9 @@
 #include "dsymbol.h"
 #include "hdrgen.h"
 #include "lexer.h"
+#include "server.h"
+#include "timetrace.h"
+#include "utf.h"
 
 #ifdef IN_GCC
 #include "d-dmd-gcc.h"
@@ -37,12 +45,28 @@ Modules Module::amodules;
 Dsymbols Module::deferred; // deferred Dsymbol's needing semantic() run on them
 Dsymbols Module::deferred3;
 unsigned Module::dprogress;
+size_t Module::deferredRuns;
+
+/* Dsymbol's deferred because of another one, the blocker, wait for it
+ * instead of being in deferred[], and go back there when it gets further
+ * with its semantic(). deferredState maps each Dsymbol to its blocker
+ * while it waits, to &deferred while it is in deferred[], or to NULL.
+ */
+static AA *deferredState;
+static AA *deferredWaiters;     // blocker => Dsymbols waiting for it
+static Dsymbols deferredWaiting; // all the waiting ones, in order
+static size_t numWaiting;
+AsyncRead *Module::prefetcher;
+bool Module::lazyBodies;
 
 const char *lookForSourceFile(const char *filename);
 
+static StringTable prefetched;   // of Prefetch's, see Module::prefetch()
+
 void Module::init()
 {
     modules = new DsymbolTable();
+    prefetched._init();
 }
 
 Module::Module(const char *filename, Identifier *ident, int doDocComment, int doHdrGen)
@@ -76,6 +100,8 @@ Module::Module(const char *filename, Identifier *ident, int doDocComment, int do
     importedFrom = NULL;
     srcfile = NULL;
     docfile = NULL;
+    lexed = NULL;
+    nlazyBodies = 0;
 
     debuglevel = 0;
     debugids = NULL;
@@ -193,14 +219,15 @@ const char *Module::kind()
     return "module";
 }
 
-Module *Module::load(Loc loc, Identifiers *packages, Identifier *ident)
-{
-    //printf("Module::load(ident = '%s')\n", ident->toChars());
+/********************************************
+ * Build module filename by turning:
+ *  foo.bar.baz
+ * into:
+ *  foo\bar\baz
+ */
 
-    // Build module filename by turning:
-    //  foo.bar.baz
-    // into:
-    //  foo\bar\baz
+static char *moduleFileName(Identifiers *packages, Identifier *ident)
+{
     char *filename = ident->toChars();
     if (packages && packages->dim)
     {
@@ -220,15 +247,76 @@ Module *Module::load(Loc loc, Identifiers *packages, Identifier *ident)
         buf.writeByte(0);
         filename = (char *)buf.extractData();
     }
+    return filename;
+}
+
+/* An import the parser has seen, kept in prefetched by module filename
+ */
+struct Prefetch
+{
+    const char *path;           // result of lookForSourceFile(), NULL if not found
+    File *file;                 // being read by Module::prefetcher
+    size_t i;                   // index of file in Module::prefetcher
+};
+
+/********************************************
+ * Called by the parser for each import it sees, so the file can be
+ * found and read on another thread while the parse carries on.
+ * load() then picks it up. Imports in a version, debug or static if
+ * are left to load(), as the branch may not be taken.
+ */
+
+void Module::prefetch(Identifiers *packages, Identifier *ident)
+{
+    if (!prefetcher)
+        return;
+
+    char *filename = moduleFileName(packages, ident);
+    StringValue *sv = prefetched.update(filename, strlen(filename));
+    if (sv->ptrvalue)
+        return;                 // already seen
+
+    Prefetch *p = new Prefetch();
+    p->path = lookForSourceFile(filename);
+    p->file = NULL;
+    p->i = 0;
+    if (p->path)
+    {
+        p->file = new File(p->path);
+        p->i = prefetcher->addFile(p->file);
+    }
+    sv->ptrvalue = p;
+}
+
+Module *Module::load(Loc loc, Identifiers *packages, Identifier *ident)
+{
+    //printf("Module::load(ident = '%s')\n", ident->toChars());
+
+    char *filename = moduleFileName(packages, ident);
 
     Module *m = new Module(filename, ident, 0, 0);
     m->loc = loc;
 
-    /* Look for the source file
+    /* Look for the source file, unless prefetch() already has
      */
-    const char *result = lookForSourceFile(filename);
-    if (result)
-        m->srcfile = new File(result);
+    Prefetch *p = NULL;
+    if (prefetcher)
+    {
+        StringValue *sv = prefetched.lookup(filename, strlen(filename));
+        if (sv)
+            p = (Prefetch *)sv->ptrvalue;
+    }
+    if (p)
+    {
+        if (p->file)
+            m->srcfile = p->file;
+    }
+    else
+    {
+        const char *result = lookForSourceFile(filename);
+        if (result)
+            m->srcfile = new File(result);
+    }
 
     if (global.params.verbose)
     {
@@ -244,10 +332,23 @@ Module *Module::load(Loc loc, Identifiers *packages, Identifier *ident)
         fprintf(global.stdmsg, "%s\t(%s)\n", ident->toChars(), m->srcfile->toChars());
     }
 
-    if (!m->read(loc))
-        return NULL;
+    if (Module *mw = CompileServer::lookup(m))
+    {
+        // Already parsed by the compile server
+        m = mw;
+        m->loc = loc;
+        m->enter();
+    }
+    else
+    {
+        if (p && p->file)
+            prefetcher->read(p->i);     // errors are reported by read(loc)
+        if (!m->read(loc))
+            return NULL;
 
-    m->parse();
+        m->parse();
+        CompileServer::loaded(m, ident);
+    }
 
 #ifdef IN_GCC
     d_gcc_magic_module(m);
@@ -259,7 +360,8 @@ Module *Module::load(Loc loc, Identifiers *packages, Identifier *ident)
 bool Module::read(Loc loc)
 {
     //printf("Module::read('%s') file '%s'\n", toChars(), srcfile->toChars());
-    if (srcfile->read())
+    TimeTraceScope tt("module", "read", this);
+    if (srcfile->mmread())
     {
         if (!strcmp(srcfile->toChars(), "object.d"))
         {
@@ -299,6 +401,13 @@ bool Module::read(Loc loc)
     return true;
 }
 
+// Whether the host stores the least significant byte first
+inline bool hostIsLE()
+{
+    unsigned short one = 1;
+    return *(unsigned char *)&one == 1;
+}
+
 inline unsigned readwordLE(unsigned short *p)
 {
     return (((unsigned char *)p)[1] << 8) | ((unsigned char *)p)[0];
@@ -325,12 +434,48 @@ inline unsigned readlongBE(unsigned *p)
         (((unsigned char *)p)[0] << 24);
 }
 
+/*********************************************
+ * Scan the source file ahead of parse(), which then replays the
+ * tokens instead of lexing. This touches nothing shared but the
+ * identifier table, so it can run on a worker thread (-j=N) while
+ * other modules are parsed.
+ * Only plain UTF-8 D source is done here; anything parse() would
+ * convert first, and sources with lexical errors, are left for
+ * parse() to scan the ordinary way.
+ */
+
+void Module::lexAhead()
+{
+    utf8_t *buf = (utf8_t *)srcfile->buffer;
+    size_t buflen = srcfile->len;
+
+    if (buflen >= 2 && (buf[0] == 0 || buf[0] >= 0x80 || buf[1] == 0))
+        return;                 // BOM or UTF-16/32
+    if (buflen >= 4 && memcmp(buf, "Ddoc", 4) == 0)
+        return;
+
+    Lexer lex(this, buf, 0, buflen, docfile != NULL, 0);
+    lexed = lex.scanAll();
+}
+
 void Module::parse()
 {
     //printf("Module::parse()\n");
+    TimeTraceScope tt("module", "parse", this);
+    parseSource();
+    if (!isDocFile)
+        enter();
+}
 
-    char *srcname = srcfile->name->toChars();
-    //printf("Module::parse(srcname = '%s')\n", srcname);
+/*********************************************
+ * The syntactic parse proper: convert the source text to UTF-8,
+ * parse it, and release the text unless function bodies were
+ * left for later (see lazyBodies).
+ */
+
+void Module::parseSource()
+{
+    //printf("Module::parseSource(srcname = '%s')\n", srcfile->name->toChars());
 
     isPackageFile = (strcmp(srcfile->name->name(), "package.d") == 0);
 
@@ -367,7 +512,13 @@ void Module::parse()
                 }
 
                 dbuf.reserve(buflen / 4);
-                for (pu += bom; pu < pumax; pu++)
+                pu += bom;
+                if (le && hostIsLE())
+                {   // Convert the valid prefix in bulk
+                    dbuf.reserve((pumax - pu) * 4);
+                    pu += utf_fromUTF32(pu, pumax - pu, dbuf.data, &dbuf.offset);
+                }
+                for (; pu < pumax; pu++)
                 {   unsigned u;
 
                     u = le ? readlongLE(pu) : readlongBE(pu);
@@ -402,7 +553,13 @@ void Module::parse()
                 }
 
                 dbuf.reserve(buflen / 2);
-                for (pu += bom; pu < pumax; pu++)
+                pu += bom;
+                if (le && hostIsLE())
+                {   // Convert the valid prefix in bulk
+                    dbuf.reserve((pumax - pu) * 3);
+                    pu += utf_fromUTF16(pu, pumax - pu, dbuf.data, &dbuf.offset);
+                }
+                for (; pu < pumax; pu++)
                 {   unsigned u;
 
                     u = le ? readwordLE(pu) : readwordBE(pu);
@@ -509,18 +666,38 @@ void Module::parse()
             setDocfile();
         return;
     }
+    size_t nskipped;
     {
         Parser p(this, buf, buflen, docfile != NULL);
+        if (buf == (utf8_t *)srcfile->buffer)
+            p.lexed = lexed;
+        p.skipBodies = lazyBodies && !isRoot();
         p.nextToken();
         members = p.parseModule();
         md = p.md;
         numlines = p.scanloc.linnum;
+        nskipped = p.nskipped;
+    }
+    if (lexed)
+    {
+        mem.free(lexed);
+        lexed = NULL;
     }
 
-    if (srcfile->ref == 0)
-        ::free(srcfile->buffer);
-    srcfile->buffer = NULL;
-    srcfile->len = 0;
+    // Skipped function bodies are parsed from the text later
+    nlazyBodies = nskipped;
+    if (!nlazyBodies)
+        srcfile->freebuffer();
+}
+
+/*********************************************
+ * Enter the parsed module into the symbol table for its package,
+ * and into amodules.
+ */
+
+void Module::enter()
+{
+    char *srcname = srcfile->name->toChars();
 
     /* The symbol table into which the module is to be inserted.
      */
@@ -638,6 +815,7 @@ void Module::importAll(Scope *prevsc)
         error("is a Ddoc file, cannot import it");
         return;
     }
+    TimeTraceScope tt("module", "importAll", this);
 
     /* Note that modules get their own scope, from scratch.
      * This is so regardless of where in the syntax a module
@@ -697,6 +875,7 @@ void Module::semantic()
 
     //printf("+Module::semantic(this = %p, '%s'): parent = %p\n", this, toChars(), parent);
     semanticRun = PASSsemantic;
+    TimeTraceScope tt("module", "semantic1", this);
 
     // Note that modules get their own scope, from scratch.
     // This is so regardless of where in the syntax a module
@@ -734,6 +913,7 @@ void Module::semantic2()
     if (semanticRun != PASSsemanticdone)       // semantic() not completed yet - could be recursive call
         return;
     semanticRun = PASSsemantic2;
+    TimeTraceScope tt("module", "semantic2", this);
 
     // Note that modules get their own scope, from scratch.
     // This is so regardless of where in the syntax a module
@@ -760,6 +940,7 @@ void Module::semantic3()
     if (semanticRun != PASSsemantic2done)
         return;
     semanticRun = PASSsemantic3;
+    TimeTraceScope tt("module", "semantic3", this);
 
     // Note that modules get their own scope, from scratch.
     // This is so regardless of where in the syntax a module
@@ -839,29 +1020,101 @@ Dsymbol *Module::search(Loc loc, Identifier *ident, int flags)
 
 /*******************************************
  * Can't run semantic on s now, try again later.
+ * If it is because of blocker, wait until
+ * resumeDeferredSemantic(blocker) is called.
  */
 
-void Module::addDeferredSemantic(Dsymbol *s)
+void Module::addDeferredSemantic(Dsymbol *s, Dsymbol *blocker)
 {
     // Don't add it if it is already there
-    for (size_t i = 0; i < deferred.dim; i++)
+    void **pstate = (void **)_aaGet(&deferredState, s);
+    if (*pstate)
+        return;
+
+    //printf("Module::addDeferredSemantic('%s')\n", s->toChars());
+    if (blocker && blocker != s)
     {
-        Dsymbol *sd = deferred[i];
+        *pstate = blocker;
+        Dsymbols **pw = (Dsymbols **)_aaGet(&deferredWaiters, blocker);
+        if (!*pw)
+            *pw = new Dsymbols();
+        (*pw)->push(s);
+        deferredWaiting.push(s);
+        numWaiting++;
+    }
+    else
+    {
+        *pstate = &deferred;
+        deferred.push(s);
+    }
+}
 
-        if (sd == s)
-            return;
+/*******************************************
+ * blocker got further with its semantic(), so the Dsymbol's
+ * waiting for it can try again.
+ */
+
+void Module::resumeDeferredSemantic(Dsymbol *blocker)
+{
+    if (!numWaiting)
+        return;
+    Dsymbols *w = (Dsymbols *)_aaGetRvalue(deferredWaiters, blocker);
+    if (!w)
+        return;
+    for (size_t i = 0; i < w->dim; i++)
+    {
+        Dsymbol *s = (*w)[i];
+        void **pstate = (void **)_aaGet(&deferredState, s);
+        if (*pstate == blocker)         // else it stopped waiting already
+        {
+            *pstate = &deferred;
+            deferred.push(s);
+            numWaiting--;
+        }
     }
+    w->setDim(0);
+}
 
-    //printf("Module::addDeferredSemantic('%s')\n", s->toChars());
-    deferred.push(s);
+/*******************************************
+ * Put all the waiting Dsymbol's back in deferred[].
+ */
+
+static void resumeAllDeferred()
+{
+    for (size_t i = 0; i < deferredWaiting.dim; i++)
+    {
+        Dsymbol *s = deferredWaiting[i];
+        void **pstate = (void **)_aaGet(&deferredState, s);
+        if (*pstate && *pstate != &Module::deferred)
+        {
+            Dsymbols *w = (Dsymbols *)_aaGetRvalue(deferredWaiters, *pstate);
+            w->setDim(0);
+            *pstate = &Module::deferred;
+            Module::deferred.push(s);
+        }
+    }
+    deferredWaiting.setDim(0);
+    numWaiting = 0;
 }
 
 
+/*******************************************
+ * Number of Dsymbol's needing semantic() run on them, in deferred[]
+ * or waiting for a blocker. Use it rather than deferred.dim.
+ */
+
+size_t Module::numDeferred()
+{
+    return deferred.dim + numWaiting;
+}
+
 /******************************************
  * Run semantic() on deferred symbols.
+ * The ones waiting for a blocker are left alone, unless
+ * this is the last chance to resolve them.
  */
 
-void Module::runDeferredSemantic()
+void Module::runDeferredSemantic(bool last)
 {
     if (dprogress == 0)
         return;
@@ -872,41 +1125,56 @@ void Module::runDeferredSemantic()
     //if (deferred.dim) printf("+Module::runDeferredSemantic(), len = %d\n", deferred.dim);
     nested++;
 
-    size_t len;
-    do
+    while (1)
     {
         dprogress = 0;
-        len = deferred.dim;
-        if (!len)
+        size_t len = deferred.dim + numWaiting;
+        if (last && !deferred.dim)
+            resumeAllDeferred();
+        bool all = numWaiting == 0;     // if trying every deferred symbol
+        if (!deferred.dim)
             break;
 
+        size_t dim = deferred.dim;
         Dsymbol **todo;
         Dsymbol **todoalloc = NULL;
         Dsymbol *tmp;
-        if (len == 1)
+        if (dim == 1)
         {
             todo = &tmp;
         }
         else
         {
-            todo = (Dsymbol **)malloc(len * sizeof(Dsymbol *));
+            todo = (Dsymbol **)malloc(dim * sizeof(Dsymbol *));
             assert(todo);
             todoalloc = todo;
         }
-        memcpy(todo, deferred.tdata(), len * sizeof(Dsymbol *));
+        memcpy(todo, deferred.tdata(), dim * sizeof(Dsymbol *));
         deferred.setDim(0);
+        for (size_t i = 0; i < dim; i++)
+            *(void **)_aaGet(&deferredState, todo[i]) = NULL;
 
-        for (size_t i = 0; i < len; i++)
+        for (size_t i = 0; i < dim; i++)
         {
             Dsymbol *s = todo[i];
 
+            deferredRuns++;
             s->semantic(NULL);
             //printf("deferred: %s, parent = %s\n", s->toChars(), s->parent->toChars());
         }
         //printf("\tdeferred.dim = %d, len = %d, dprogress = %d\n", deferred.dim, len, dprogress);
         if (todoalloc)
             free(todoalloc);
-    } while (deferred.dim < len || dprogress);  // while making progress
+
+        if (deferred.dim + numWaiting < len || dprogress)
+            continue;                   // making progress
+        if (!last || all)
+            break;
+        // Try the waiting ones too, before giving up
+        resumeAllDeferred();
+    }
+    if (last)
+        resumeAllDeferred();            // so they are in deferred[]
     nested--;
     //printf("-Module::runDeferredSemantic(), len = %d\n", deferred.dim);
 }
@@ -1134,7 +1402,8 @@ Dsymbol *Package::search(Loc loc, Identifier *ident, int flags)
 /********************************************
  * Look for the source file if it's different from filename.
  * Look for .di, .d, directory, and along global.path.
- * Does not open the file.
+ * Does not open the file. Uses listings of the directories
+ * rather than asking the file system about each candidate.
  * Input:
  *      filename        as supplied by the user
  *      global.path
@@ -1149,21 +1418,21 @@ const char *lookForSourceFile(const char *filename)
      */
 
     const char *sdi = FileName::forceExt(filename, global.hdr_ext);
-    if (FileName::exists(sdi) == 1)
+    if (FileName::existsCached(sdi) == 1)
         return sdi;
 
     const char *sd  = FileName::forceExt(filename, global.mars_ext);
-    if (FileName::exists(sd) == 1)
+    if (FileName::existsCached(sd) == 1)
         return sd;
 
-    if (FileName::exists(filename) == 2)
+    if (FileName::existsCached(filename) == 2)
     {
         /* The filename exists and it's a directory.
          * Therefore, the result should be: filename/package.d
          * iff filename/package.d is a file
          */
         const char *n = FileName::combine(filename, "package.d");
-        if (FileName::exists(n) == 1)
+        if (FileName::existsCached(n) == 1)
             return n;
         FileName::free(n);
     }
@@ -1179,22 +1448,22 @@ const char *lookForSourceFile(const char *filename)
         const char *p = (*global.path)[i];
 
         const char *n = FileName::combine(p, sdi);
-        if (FileName::exists(n) == 1)
+        if (FileName::existsCached(n) == 1)
             return n;
         FileName::free(n);
 
         n = FileName::combine(p, sd);
-        if (FileName::exists(n) == 1)
+        if (FileName::existsCached(n) == 1)
             return n;
         FileName::free(n);
 
         const char *b = FileName::removeExt(filename);
         n = FileName::combine(p, b);
         FileName::free(b);
-        if (FileName::exists(n) == 2)
+        if (FileName::existsCached(n) == 2)
         {
             const char *n2 = FileName::combine(n, "package.d");
-            if (FileName::exists(n2) == 1)
+            if (FileName::existsCached(n2) == 1)
                 return n2;
             FileName::free(n2);
         }
@@ -23,8 +23,10 @@ class ClassDeclaration;
 struct ModuleDeclaration;
 struct Macro;
 struct Escape;
+struct Token;
 class VarDeclaration;
 class Library;
+struct AsyncRead;
 
 // Back end
 #ifdef IN_GCC
@@ -69,6 +71,7 @@ public:
     static Dsymbols deferred;   // deferred Dsymbol's needing semantic() run on them
     static Dsymbols deferred3;  // deferred Dsymbol's needing semantic3() run on them
     static unsigned dprogress;  // progress resolving the deferred list
+    static size_t deferredRuns; // semantic() runs on deferred Dsymbol's
     static void init();
 
     static AggregateDeclaration *moduleinfo;
@@ -81,6 +84,8 @@ public:
     File *hdrfile;      // 'header' file
     File *symfile;      // output symbol file
     File *docfile;      // output documentation file
+    Token *lexed;       // tokens scanned ahead by lexAhead(), NULL if none
+    size_t nlazyBodies; // function bodies left for parseLazyBody(), which need srcfile
     unsigned errors;    // if any errors in file
     unsigned numlines;  // number of lines in source file
     int isDocFile;      // if it is a documentation input file, not D source
@@ -119,12 +124,18 @@ public:
     static Module* create(const char *arg, Identifier *ident, int doDocComment, int doHdrGen);
 
     static Module *load(Loc loc, Identifiers *packages, Identifier *ident);
+    static AsyncRead *prefetcher;       // reads imports ahead of load(), NULL if not
+    static bool lazyBodies;             // parse function bodies of imports only when needed
+    static void prefetch(Identifiers *packages, Identifier *ident);
 
     const char *kind();
     File *setOutfile(const char *name, const char *dir, const char *arg, const char *ext);
     void setDocfile();
     bool read(Loc loc); // read file, returns 'true' if succeed, 'false' otherwise.
+    void lexAhead();    // scan tokens for parse(), may run on a worker thread
     void parse();       // syntactic parse
+    void parseSource(); // parse() without enter()
+    void enter();       // enter into the module symbol tables
     void importAll(Scope *sc);
     void semantic();    // semantic analysis
     void semantic2();   // pass 2 semantic analysis
@@ -135,8 +146,10 @@ public:
     int needModuleInfo();
     Dsymbol *search(Loc loc, Identifier *ident, int flags = IgnoreNone);
     void deleteObjFile();
-    static void addDeferredSemantic(Dsymbol *s);
-    static void runDeferredSemantic();
+    static void addDeferredSemantic(Dsymbol *s, Dsymbol *blocker = NULL);
+    static void resumeDeferredSemantic(Dsymbol *blocker);
+    static size_t numDeferred();
+    static void runDeferredSemantic(bool last = false);
     static void addDeferredSemantic3(Dsymbol *s);
     static void runDeferredSemantic3();
     int imports(Module *m);
@@ -43,6 +43,7 @@
 #include "import.h"
 #include "aggregate.h"
 #include "hdrgen.h"
+#include "memstats.h"
 
 FuncDeclaration *hasThis(Scope *sc);
 void toCBuffer(Type *t, OutBuffer *buf, Identifier *ident, HdrGenState *hgs);
@@ -126,8 +127,14 @@ unsigned char Type::sizeTy[TMAX];
 StringTable Type::stringtable;
 
 
+void *Type::operator new(size_t size)
+{
+    return MemStats::allocate(size, NODEtype);
+}
+
 Type::Type(TY ty)
 {
+    mem.keepRegions();          // types are cached and merged
     this->ty = ty;
     this->mod = 0;
     this->deco = NULL;
@@ -156,6 +163,8 @@ Type *Type::copy()
 {
     Type *t = (Type *)mem.malloc(sizeTy[ty]);
     memcpy((void*)t, (void*)this, sizeTy[ty]);
+    if (MemStats::enabled)
+        MemStats::record(t, sizeTy[ty], NODEtype);
     return t;
 }
 
@@ -1965,6 +1974,140 @@ MATCH Type::constConv(Type *to)
     return MATCHnomatch;
 }
 
+/***************************************
+ * Overload resolution and template deduction ask for the same conversions
+ * over and over. The answers for merged types whose conversions can no
+ * longer change are kept in a hash table keyed on the pair of types.
+ */
+
+struct ConvEntry
+{
+    Type *from;
+    Type *to;
+    MATCH match;
+};
+
+static ConvEntry *convTable;    // open addressed, at most half full
+static size_t convDim;          // power of 2
+static size_t convCount;
+
+size_t Type::convLookups;
+size_t Type::convHits;
+
+/* Conversions from and to t don't depend on anything that semantic()
+ * may still change, and don't go through alias this.
+ */
+static bool convStable(Type *t)
+{
+    if (!t->deco)
+        return false;
+    switch (t->ty)
+    {
+        case Tpointer:
+        case Tarray:
+        case Tsarray:
+            return convStable(t->nextOf());
+
+        case Taarray:
+            return convStable(((TypeAArray *)t)->index) && convStable(t->nextOf());
+
+        case Tstruct:
+        {
+            StructDeclaration *sd = ((TypeStruct *)t)->sym;
+            return sd->sizeok == SIZEOKdone && !sd->aliasthis;
+        }
+
+        case Tclass:
+        {
+            ClassDeclaration *cd = ((TypeClass *)t)->sym;
+            return cd->semanticRun >= PASSsemanticdone && cd->isBaseInfoComplete() &&
+                   !cd->aliasthis;
+        }
+
+        case Tnull:
+        case Tvector:
+            return true;
+
+        default:
+            return t->isTypeBasic() != NULL;
+    }
+}
+
+static inline size_t convHash(Type *from, Type *to)
+{
+    size_t h = ((size_t)from >> 4) * 31 + ((size_t)to >> 4);
+    return h ^ (h >> 13);
+}
+
+/***************************************
+ * If the conversion of this to type to is in the cache, set *pm to it
+ * and return true.
+ */
+
+bool Type::convCached(Type *to, MATCH *pm)
+{
+    convLookups++;
+    if (!convCount)
+        return false;
+    size_t mask = convDim - 1;
+    for (size_t i = convHash(this, to) & mask; convTable[i].from; i = (i + 1) & mask)
+    {
+        if (convTable[i].from == this && convTable[i].to == to)
+        {
+            convHits++;
+            *pm = convTable[i].match;
+            return true;
+        }
+    }
+    return false;
+}
+
+/***************************************
+ * Remember m as the conversion of this to type to, if it can't change.
+ * Returns m.
+ */
+
+MATCH Type::convCache(Type *to, MATCH m)
+{
+    if (!convStable(this) || !convStable(to))
+        return m;
+
+    if ((convCount + 1) * 2 > convDim)
+    {
+        size_t newdim = convDim ? convDim * 2 : 256;
+        ConvEntry *newp = (ConvEntry *)mem.calloc(newdim, sizeof(ConvEntry));
+        size_t mask = newdim - 1;
+        for (size_t j = 0; j < convDim; j++)
+        {
+            ConvEntry *e = &convTable[j];
+            if (e->from)
+            {
+                size_t i = convHash(e->from, e->to) & mask;
+                while (newp[i].from)
+                    i = (i + 1) & mask;
+                newp[i] = *e;
+            }
+        }
+        mem.free(convTable);
+        convTable = newp;
+        convDim = newdim;
+    }
+
+    size_t mask = convDim - 1;
+    size_t i = convHash(this, to) & mask;
+    while (convTable[i].from)
+    {
+        if (convTable[i].from == this && convTable[i].to == to)
+            return m;
+        i = (i + 1) & mask;
+    }
+    convTable[i].from = this;
+    convTable[i].to = to;
+    convTable[i].match = m;
+    convCount++;
+    return m;
+}
+
 /***************************************
  * Return MOD bits matching this type to wild parameter type (tprm).
  */
@@ -8265,6 +8408,9 @@ MATCH TypeStruct::implicitConvTo(Type *to)
 
     //printf("TypeStruct::implicitConvTo(%s => %s)\n", toChars(), to->toChars());
 
+    if (convCached(to, &m))
+        return m;
+
     if (ty == to->ty && sym == ((TypeStruct *)to)->sym)
     {
         m = MATCHexact;         // exact match
@@ -8292,7 +8438,7 @@ MATCH TypeStruct::implicitConvTo(Type *to)
                     else
                     {
                         if (m <= MATCHnomatch)
-                            return m;
+                            return convCache(to, m);
                     }
 
                     // 'from' type
@@ -8306,7 +8452,7 @@ MATCH TypeStruct::implicitConvTo(Type *to)
                     //printf("\t%s => %s, match = %d\n", v->type->toChars(), tv->toChars(), mf);
 
                     if (mf <= MATCHnomatch)
-                        return mf;
+                        return convCache(to, mf);
                     if (mf < m)         // if field match is worse
                         m = mf;
                     offset = v->offset;
@@ -8322,7 +8468,7 @@ MATCH TypeStruct::implicitConvTo(Type *to)
     }
     else
         m = MATCHnomatch;       // no match
-    return m;
+    return convCache(to, m);
 }
 
 MATCH TypeStruct::constConv(Type *to)
@@ -8830,10 +8976,14 @@ int TypeClass::isBaseOf(Type *t, int *poffset)
 MATCH TypeClass::implicitConvTo(Type *to)
 {
     //printf("TypeClass::implicitConvTo(to = '%s') %s\n", to->toChars(), toChars());
-    MATCH m = constConv(to);
-    if (m > MATCHnomatch)
+    MATCH m;
+    if (convCached(to, &m))
         return m;
 
+    m = constConv(to);
+    if (m > MATCHnomatch)
+        return convCache(to, m);
+
     ClassDeclaration *cdto = to->isClassHandle();
     if (cdto)
     {
@@ -8845,7 +8995,7 @@ MATCH TypeClass::implicitConvTo(Type *to)
         if (cdto->isBaseOf(sym, NULL) && MODimplicitConv(mod, to->mod))
         {
             //printf("'to' is base\n");
-            return MATCHconvert;
+            return convCache(to, MATCHconvert);
         }
     }
 
@@ -8857,7 +9007,7 @@ MATCH TypeClass::implicitConvTo(Type *to)
         att = (AliasThisRec)(att & ~RECtracing);
     }
 
-    return m;
+    return convCache(to, m);
 }
 
 MATCH TypeClass::constConv(Type *to)
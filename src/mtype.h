@@ -222,6 +222,9 @@ public:
     static unsigned char sizeTy[TMAX];
     static StringTable stringtable;
 
+    static size_t convLookups;          // calls to convCached()
+    static size_t convHits;             // of them answered from the cache
+
     // These tables are for implicit conversion of binary ops;
     // the indices are the type of operand one, followed by operand two.
     static unsigned char impcnvResult[TMAX][TMAX];
@@ -231,6 +234,7 @@ public:
     // If !=0, give warning on implicit conversion
     static unsigned char impcnvWarn[TMAX][TMAX];
 
+    static void *operator new(size_t size);
     Type(TY ty);
     virtual const char *kind();
     Type *copy();
@@ -319,6 +323,8 @@ public:
     virtual int isBaseOf(Type *t, int *poffset);
     virtual MATCH implicitConvTo(Type *to);
     virtual MATCH constConv(Type *to);
+    bool convCached(Type *to, MATCH *pm);
+    MATCH convCache(Type *to, MATCH m);
     virtual unsigned char deduceWild(Type *t, bool isRef);
     virtual Type *substWildTo(unsigned mod);
 
@@ -63,6 +63,9 @@ Parser::Parser(Module *module, const utf8_t *base, size_t length, int doDocComme
     endloc = Loc();
     inBrackets = 0;
     lookingForElse = Loc();
+    skipBodies = 0;
+    nskipped = 0;
+    inCondition = 0;
     //nextToken();              // start up the scanner
 }
 
@@ -77,14 +80,15 @@ Parser::Parser(Loc loc, Module *module, const utf8_t *base, size_t length, int d
     //printf("Parser::Parser()\n");
     scanloc = loc;
 
-    if (loc.filename)
+    if (loc.filename())
     {
         /* Create a pseudo-filename for the mixin string, as it may not even exist
          * in the source file.
          */
-        char *filename = (char *)mem.malloc(strlen(loc.filename) + 7 + sizeof(loc.linnum) * 3 + 1);
-        sprintf(filename, "%s-mixin-%d", loc.filename, (int)loc.linnum);
-        scanloc.filename = filename;
+        char *filename = (char *)mem.malloc(strlen(loc.filename()) + 7 + sizeof(loc.linnum) * 3 + 1);
+        sprintf(filename, "%s-mixin-%d", loc.filename(), (int)loc.linnum);
+        scanloc.setFilename(filename);
+        mem.free(filename);
     }
 
     md = NULL;
@@ -92,6 +96,9 @@ Parser::Parser(Loc loc, Module *module, const utf8_t *base, size_t length, int d
     endloc = Loc();
     inBrackets = 0;
     lookingForElse = Loc();
+    skipBodies = 0;
+    nskipped = 0;
+    inCondition = 0;
     //nextToken();              // start up the scanner
 }
 
@@ -379,6 +386,7 @@ Dsymbols *Parser::parseDeclDefs(int once, Dsymbol **pLastDecl, PrefixAttributes
                 else if (next == TOKif)
                 {
                     condition = parseStaticIfCondition();
+                    inCondition++;
                     Dsymbols *athen;
                     if (token.value == TOKcolon)
                         athen = parseBlock(pLastDecl);
@@ -397,6 +405,7 @@ Dsymbols *Parser::parseDeclDefs(int once, Dsymbol **pLastDecl, PrefixAttributes
                         aelse = parseBlock(pLastDecl);
                         checkDanglingElse(elseloc);
                     }
+                    inCondition--;
                     s = new StaticIfDeclaration(condition, athen, aelse);
                 }
                 else if (next == TOKimport)
@@ -800,6 +809,7 @@ Dsymbols *Parser::parseDeclDefs(int once, Dsymbol **pLastDecl, PrefixAttributes
 
             Lcondition:
             {
+                inCondition++;
                 Dsymbols *athen;
                 if (token.value == TOKcolon)
                     athen = parseBlock(pLastDecl);
@@ -818,6 +828,7 @@ Dsymbols *Parser::parseDeclDefs(int once, Dsymbol **pLastDecl, PrefixAttributes
                     aelse = parseBlock(pLastDecl);
                     checkDanglingElse(elseloc);
                 }
+                inCondition--;
                 s = new ConditionalDeclaration(condition, athen, aelse);
                 break;
             }
@@ -2645,6 +2656,8 @@ Dsymbols *Parser::parseImport()
 
         Import *s = new Import(loc, a, id, aliasid, isstatic);
         decldefs->push(s);
+        if (!inCondition)
+            Module::prefetch(a, id);    // a branch not taken needn't be read
 
         /* Look for
          *      : alias=name, alias=name;
@@ -3820,6 +3833,80 @@ Dsymbols *Parser::parseAutoDeclarations(StorageClass storageClass, const utf8_t
     return a;
 }
 
+/*****************************************
+ * Skip over the { } function body starting at the current token,
+ * leaving it to parseLazyBody() to parse if it is ever needed.
+ * Meanwhile fbody is an empty statement that the parsed statements
+ * are put into later, so the function still counts as having a body
+ * and the body can be wrapped by semantic().
+ */
+
+void Parser::skipBody(FuncDeclaration *f)
+{
+    LazyBody *lb = new LazyBody();
+    lb->mod = mod;
+    lb->start = token.ptr;
+    lb->line = token.ptr - (token.loc.charnum - 1);
+    lb->loc = token.loc;
+
+    /* Lexical errors in the body are reported when it is parsed,
+     * not by this scan as well.
+     */
+    gagErrors++;
+    int nest = 0;
+    while (1)
+    {
+        switch (token.value)
+        {
+            case TOKlcurly:
+                nest++;
+                break;
+
+            case TOKrcurly:
+                if (--nest)
+                    break;
+                gagErrors--;
+                endloc = token.loc;
+                lb->length = token.ptr + 1 - lb->start;
+                nextToken();
+                lb->fbody = new CompoundStatement(lb->loc, new Statements());
+                f->fbody = lb->fbody;
+                f->lazyBody = lb;
+                nskipped++;
+                return;
+
+            case TOKeof:
+            {
+                /* Unterminated, so parse it now for the errors. The rest
+                 * of the source is all in this body.
+                 */
+                gagErrors--;
+                lb->length = token.ptr - lb->start;
+                f->fbody = parseLazyBody(lb);
+                return;
+            }
+
+            default:
+                break;
+        }
+        nextToken();
+    }
+}
+
+/*****************************************
+ * Parse a function body skipped by skipBody().
+ * The source it is in must still be around.
+ */
+
+CompoundStatement *Parser::parseLazyBody(LazyBody *lb)
+{
+    Parser p(lb->mod, lb->start, lb->length, 0);
+    p.scanloc = lb->loc;
+    p.line = lb->line;
+    p.nextToken();
+    return p.parseStatement(PSsemi)->isCompoundStatement();
+}
+
 /*****************************************
  * Parse contracts following function declaration.
  */
@@ -3839,13 +3926,19 @@ L1:
         case TOKlcurly:
             if (f->frequire || f->fensure)
                 error("missing body { ... } after in or out");
-            f->fbody = parseStatement(PSsemi);
+            if (skipBodies && !literal)
+                skipBody(f);
+            else
+                f->fbody = parseStatement(PSsemi);
             f->endloc = endloc;
             break;
 
         case TOKbody:
             nextToken();
-            f->fbody = parseStatement(PScurly);
+            if (skipBodies && !literal && token.value == TOKlcurly)
+                skipBody(f);
+            else
+                f->fbody = parseStatement(PScurly);
             f->endloc = endloc;
             break;
 
@@ -4845,6 +4938,7 @@ Statement *Parser::parseStatement(int flags, const utf8_t** endPtr)
             goto Lcondition;
 
         Lcondition:
+            inCondition++;
             {
                 Loc lookingForElseSave = lookingForElse;
                 lookingForElse = loc;
@@ -4859,6 +4953,7 @@ Statement *Parser::parseStatement(int flags, const utf8_t** endPtr)
                 elsebody = parseStatement(0);
                 checkDanglingElse(elseloc);
             }
+            inCondition--;
             s = new ConditionalStatement(loc, cond, ifbody, elsebody);
             if (flags & PSscope)
                 s = new ScopeStatement(loc, s);
@@ -6166,7 +6261,7 @@ Expression *Parser::parsePrimaryExp()
             break;
 
         case TOKfile:
-        {   const char *s = loc.filename ? loc.filename : mod->ident->toChars();
+        {   const char *s = loc.filename() ? loc.filename() : mod->ident->toChars();
             e = new StringExp(loc, (char *)s, strlen(s), 0);
             nextToken();
             break;
@@ -6227,6 +6322,7 @@ Expression *Parser::parsePrimaryExp()
             utf8_t *s = token.ustring;
             size_t len = token.len;
             unsigned char postfix = token.postfix;
+            OutBuffer buf;
             while (1)
             {
                 nextToken();
@@ -6239,17 +6335,19 @@ Expression *Parser::parsePrimaryExp()
                         postfix = token.postfix;
                     }
 
-                    size_t len1 = len;
-                    size_t len2 = token.len;
-                    len = len1 + len2;
-                    utf8_t *s2 = (utf8_t *)mem.malloc((len + 1) * sizeof(utf8_t));
-                    memcpy(s2, s, len1 * sizeof(utf8_t));
-                    memcpy(s2 + len1, token.ustring, (len2 + 1) * sizeof(utf8_t));
-                    s = s2;
+                    if (!buf.offset)
+                        buf.write(s, len);
+                    buf.write(token.ustring, token.len);
                 }
                 else
                     break;
             }
+            if (buf.offset)
+            {
+                // Like the token strings, the result is shared
+                len = buf.offset;
+                s = Lexer::literalPool((utf8_t *)buf.data, len);
+            }
             e = new StringExp(loc, s, len, postfix);
             break;
         }
@@ -47,6 +47,7 @@ class TemplateDeclaration;
 class TemplateInstance;
 class StaticAssert;
 struct PrefixAttributes;
+class CompoundStatement;
 
 /************************************
  * These control how parseStatement() works.
@@ -61,6 +62,21 @@ enum ParseStatementFlags
     PSsemi_ok = 0x10,   // empty ';' are really ok
 };
 
+/************************************
+ * A function body skipped by the parser, to be parsed
+ * when it is needed (see Parser::skipBodies).
+ */
+
+struct LazyBody
+{
+    Module *mod;
+    const utf8_t *start;        // the '{'
+    size_t length;              // up to and including the matching '}'
+    const utf8_t *line;         // start of the line the '{' is on
+    Loc loc;                    // of the '{'
+    CompoundStatement *fbody;   // stands in for the body until it is parsed
+};
+
 
 class Parser : public Lexer
 {
@@ -70,6 +86,9 @@ public:
     Loc endloc;                 // set to location of last right curly
     int inBrackets;             // inside [] of array index or slice
     Loc lookingForElse;         // location of lonely if looking for an else
+    int skipBodies;             // !=0 means leave function bodies for parseLazyBody()
+    size_t nskipped;            // number of function bodies skipped
+    int inCondition;            // inside a version, debug or static if
 
     Parser(Loc loc, Module *module, const utf8_t *base, size_t length, int doDocComment);
     Parser(Module *module, const utf8_t *base, size_t length, int doDocComment);
@@ -119,6 +138,8 @@ public:
     void parseStorageClasses(StorageClass &storage_class, LINK &link, unsigned &structalign, Expressions *&udas);
     Dsymbols *parseDeclarations(bool autodecl, PrefixAttributes *pAttrs, const utf8_t *comment);
     FuncDeclaration *parseContracts(FuncDeclaration *f);
+    void skipBody(FuncDeclaration *f);
+    static CompoundStatement *parseLazyBody(LazyBody *lb);
     void checkDanglingElse(Loc elseloc);
     /** endPtr used for documented unittests */
     Statement *parseStatement(int flags, const utf8_t** endPtr = NULL);
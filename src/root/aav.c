@@ -10,6 +10,10 @@
 /**
  * Implementation of associative arrays.
  *
+ * The entries are kept in one flat array, with a parallel array of control
+ * bytes holding 7 bits of each key's hash. Lookups compare a group of 16
+ * control bytes at once (with SSE2 where available), and only look at the
+ * entries whose control byte matches.
  */
 
 #include <stdio.h>
@@ -17,32 +21,126 @@
 #include <stdlib.h>
 #include <assert.h>
 
-#include "aav.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AA_SSE2 1
+#endif
 
+#include "aav.h"
 
-inline size_t hash(size_t a)
-{
-    a ^= (a >> 20) ^ (a >> 12);
-    return a ^ (a >> 7) ^ (a >> 4);
-}
+#define GROUP   16              // control bytes compared at once
+#define EMPTY   0x80            // control byte of an unused entry
+#define PAD     0xFF            // control byte past the end of a small table
 
 struct aaA
 {
-    aaA *next;
     Key key;
     Value value;
 };
 
 struct AA
 {
-    aaA* *b;
-    size_t b_length;
-    size_t nodes;       // total number of aaA nodes
-    aaA* binit[4];      // initial value of b[]
-
-    aaA aafirst;        // a lot of these AA's have only one entry
+    unsigned char *ctrl;        // [b_length], EMPTY or low 7 bits of hash,
+                                // then PAD up to GROUP
+    aaA *b;                     // [b_length]
+    size_t b_length;            // power of 2
+    size_t nodes;               // number of entries in use
 };
 
+/* Pointers are aligned, so mix the upper bits down into
+ * the ones that select the group and the control byte.
+ */
+inline size_t hash(Key key)
+{
+    unsigned long long h = (unsigned long long)(size_t)key * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h ^ (h >> 29));
+}
+
+/*************************************************
+ * Return a bit mask of the control bytes in the group
+ * starting at ctrl that are equal to c.
+ */
+
+inline unsigned match(const unsigned char *ctrl, unsigned char c)
+{
+#if AA_SSE2
+    __m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)c)));
+#else
+    // Same thing 8 bytes at a time: set the top bit of each byte that is
+    // equal to c, then gather the top bits into the low byte
+    const unsigned long long lo7 = 0x7F7F7F7F7F7F7F7FULL;
+    unsigned m = 0;
+    for (int i = 0; i < GROUP; i += 8)
+    {
+        unsigned long long w;
+        memcpy(&w, ctrl + i, 8);
+        w ^= c * 0x0101010101010101ULL;
+        w = ~(((w & lo7) + lo7) | w | lo7);
+        m |= (unsigned)(((w >> 7) * 0x0102040810204080ULL) >> 56) << i;
+    }
+    return m;
+#endif
+}
+
+inline int lowestBit(unsigned m)
+{
+#if __GNUC__
+    return __builtin_ctz(m);
+#else
+    int i = 0;
+    while (!(m & 1))
+    {
+        m >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+
+static AA *newAA(size_t length)
+{
+    AA *aa = new AA();
+    /* A lot of these AA's have only one entry, so small tables
+     * are padded to a whole group with control bytes that never match
+     */
+    size_t ctrllength = length < GROUP ? GROUP : length;
+    aa->ctrl = new unsigned char[ctrllength];
+    memset(aa->ctrl, EMPTY, length);
+    memset(aa->ctrl + length, PAD, ctrllength - length);
+    aa->b = new aaA[length];
+    aa->b_length = length;
+    aa->nodes = 0;
+    return aa;
+}
+
+/*************************************************
+ * Find the entry for key, or the unused one where it would go.
+ * The groups are probed in triangular order, which visits each
+ * once because their number is a power of 2.
+ */
+
+static size_t search(AA *aa, Key key, size_t h)
+{
+    size_t mask = aa->b_length - 1;
+    unsigned char h2 = h & 0x7F;
+    size_t i = (h >> 7) & mask & ~(size_t)(GROUP - 1);
+    for (size_t step = GROUP; 1; step += GROUP)
+    {
+        const unsigned char *ctrl = aa->ctrl + i;
+        for (unsigned m = match(ctrl, h2); m; m &= m - 1)
+        {
+            size_t j = i + lowestBit(m);
+            if (aa->b[j].key == key)
+                return j;
+        }
+        unsigned m = match(ctrl, EMPTY);
+        if (m)
+            return i + lowestBit(m);
+        i = (i + step) & mask;
+    }
+}
+
 /****************************************************
  * Determine number of entries in associative array.
  */
@@ -56,6 +154,7 @@ size_t _aaLen(AA* aa)
 /*************************************************
  * Get pointer to value in associative array indexed by key.
  * Add entry for key if it is not already there.
+ * The pointer is valid until the next entry is added.
  */
 
 Value* _aaGet(AA** paa, Key key)
@@ -63,49 +162,32 @@ Value* _aaGet(AA** paa, Key key)
     //printf("paa = %p\n", paa);
 
     if (!*paa)
-    {   AA *a = new AA();
-        a->b = a->binit;
-        a->b_length = sizeof(a->binit) / sizeof(a->binit[0]);
-        a->nodes = 0;
-        a->binit[0] = NULL;
-        a->binit[1] = NULL;
-        a->binit[2] = NULL;
-        a->binit[3] = NULL;
-        *paa = a;
-        assert((*paa)->b_length == 4);
-    }
+        *paa = newAA(2);
     //printf("paa = %p, *paa = %p\n", paa, *paa);
 
-    assert((*paa)->b_length);
-    size_t i = hash((size_t)key) & ((*paa)->b_length - 1);
-    aaA** pe = &(*paa)->b[i];
-    aaA *e;
-    while ((e = *pe) != NULL)
-    {
-        if (key == e->key)
-            return &e->value;
-        pe = &e->next;
-    }
+    AA *aa = *paa;
+    size_t h = hash(key);
+    size_t j = search(aa, key, h);
+    if (aa->ctrl[j] != EMPTY)
+        return &aa->b[j].value;
 
     // Not found, create new elem
     //printf("create new one\n");
 
-    size_t nodes = ++(*paa)->nodes;
-    e = (nodes != 1) ? new aaA() : &(*paa)->aafirst;
-    //e = new aaA();
-    e->next = NULL;
-    e->key = key;
-    e->value = NULL;
-    *pe = e;
-
-    //printf("length = %d, nodes = %d\n", (*paa)->b_length, nodes);
-    if (nodes > (*paa)->b_length * 2)
+    // Keep at least 1/8 of the entries unused, so searches stop quickly
+    if ((aa->nodes + 1) * 8 > aa->b_length * 7)
     {
         //printf("rehash\n");
         _aaRehash(paa);
+        aa = *paa;
+        j = search(aa, key, h);
     }
 
-    return &e->value;
+    aa->nodes++;
+    aa->ctrl[j] = h & 0x7F;
+    aa->b[j].key = key;
+    aa->b[j].value = NULL;
+    return &aa->b[j].value;
 }
 
 
@@ -119,16 +201,9 @@ Value _aaGetRvalue(AA* aa, Key key)
     //printf("_aaGetRvalue(key = %p)\n", key);
     if (aa)
     {
-        size_t i;
-        size_t len = aa->b_length;
-        i = hash((size_t)key) & (len-1);
-        aaA* e = aa->b[i];
-        while (e)
-        {
-            if (key == e->key)
-                return e->value;
-            e = e->next;
-        }
+        size_t j = search(aa, key, hash(key));
+        if (aa->ctrl[j] != EMPTY)
+            return aa->b[j].value;
     }
     return NULL;    // not found
 }
@@ -144,32 +219,22 @@ void _aaRehash(AA** paa)
     if (*paa)
     {
         AA *aa = *paa;
-        if (aa)
+        AA *newaa = newAA(aa->b_length * (aa->b_length < 256 ? 4 : 2));
+        for (size_t k = 0; k < aa->b_length; k++)
         {
-            size_t len = aa->b_length;
-            if (len == 4)
-                len = 32;
-            else
-                len *= 4;
-            aaA** newb = new aaA*[len];
-            memset(newb, 0, len * sizeof(aaA*));
-
-            for (size_t k = 0; k < aa->b_length; k++)
-            {   aaA *e = aa->b[k];
-                while (e)
-                {   aaA* enext = e->next;
-                    size_t j = hash((size_t)e->key) & (len-1);
-                    e->next = newb[j];
-                    newb[j] = e;
-                    e = enext;
-                }
-            }
-            if (aa->b != aa->binit)
-                delete[] aa->b;
-
-            aa->b = newb;
-            aa->b_length = len;
+            if (aa->ctrl[k] == EMPTY)
+                continue;
+            size_t j = search(newaa, aa->b[k].key, hash(aa->b[k].key));
+            newaa->ctrl[j] = aa->ctrl[k];
+            newaa->b[j] = aa->b[k];
         }
+        newaa->nodes = aa->nodes;
+
+        // The AA itself stays where it is
+        delete[] aa->ctrl;
+        delete[] aa->b;
+        *aa = *newaa;
+        delete newaa;
     }
 }
 
@@ -186,6 +251,14 @@ void unittest_aa()
     *pv = (void *)3;
     v = _aaGetRvalue(aa, NULL);
     assert(v == (void *)3);
+
+    for (size_t i = 1; i < 1000; i++)
+        *_aaGet(&aa, (Key)(i * 16)) = (Value)i;
+    assert(_aaLen(aa) == 1000);
+    for (size_t i = 1; i < 1000; i++)
+        assert(_aaGetRvalue(aa, (Key)(i * 16)) == (Value)i);
+    assert(_aaGetRvalue(aa, NULL) == (void *)3);
+    assert(!_aaGetRvalue(aa, (Key)8));
 }
 
 #endif
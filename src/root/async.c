@@ -13,6 +13,8 @@
 #include <stdlib.h>
 #include <assert.h>
 
+typedef void (*TaskFp)(void *arg, size_t i);   // as in async.h
+
 #if _WIN32
 
 #include <windows.h>
@@ -20,6 +22,7 @@
 #include <process.h>
 
 #include "root.h"
+#include "thread.h"
 
 static unsigned __stdcall startthread(void *p);
 
@@ -33,54 +36,82 @@ struct FileData
 struct AsyncRead
 {
     static AsyncRead *create(size_t nfiles);
-    void addFile(File *file);
-    void start();
+    size_t addFile(File *file);
+    void start(size_t nthreads);
     int read(size_t i);
     static void dispose(AsyncRead *);
 
-    HANDLE hThread;
+    CRITICAL_SECTION cs;        // guards everything below
+    HANDLE sem;                 // counts files not yet handed out, and quit
+    size_t next;                // next file to read
+    bool quit;
 
     size_t filesdim;
     size_t filesmax;
-    FileData files[1];
+    FileData **files;
+
+    size_t nthreads;
+    HANDLE *threads;
 };
 
 
 AsyncRead *AsyncRead::create(size_t nfiles)
 {
-    AsyncRead *aw = (AsyncRead *)calloc(1, sizeof(AsyncRead) +
-                                (nfiles - 1) * sizeof(FileData));
-    aw->filesmax = nfiles;
+    AsyncRead *aw = (AsyncRead *)calloc(1, sizeof(AsyncRead));
+    aw->filesmax = nfiles ? nfiles : 1;
+    aw->files = (FileData **)malloc(aw->filesmax * sizeof(FileData *));
+    InitializeCriticalSection(&aw->cs);
+    aw->sem = CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+    assert(aw->files && aw->sem);
     return aw;
 }
 
-void AsyncRead::addFile(File *file)
+/*******************************************
+ * Queue file to be read. Can be called before or after start().
+ * Returns:
+ *      index to pass to read()
+ */
+
+size_t AsyncRead::addFile(File *file)
 {
     //printf("addFile(file = %p)\n", file);
-    //printf("filesdim = %d, filesmax = %d\n", filesdim, filesmax);
-    assert(filesdim < filesmax);
-    files[filesdim].file = file;
-    files[filesdim].event = CreateEvent(NULL, TRUE, FALSE, NULL);
-    ResetEvent(files[filesdim].event);
-    filesdim++;
+    FileData *f = (FileData *)calloc(1, sizeof(FileData));
+    assert(f);
+    f->file = file;
+    f->event = CreateEvent(NULL, TRUE, FALSE, NULL);
+
+    EnterCriticalSection(&cs);
+    if (filesdim == filesmax)
+    {
+        filesmax *= 2;
+        files = (FileData **)realloc(files, filesmax * sizeof(FileData *));
+        assert(files);
+    }
+    size_t i = filesdim++;
+    files[i] = f;
+    LeaveCriticalSection(&cs);
+    ReleaseSemaphore(sem, 1, NULL);
+    return i;
 }
 
-void AsyncRead::start()
+void AsyncRead::start(size_t nthreads)
 {
-    //printf("aw->filesdim = %p %d\n", this, filesdim);
-    if (filesdim)
+    assert(nthreads);
+    this->nthreads = nthreads;
+    threads = (HANDLE *)calloc(nthreads, sizeof(HANDLE));
+    for (size_t i = 0; i < nthreads; i++)
     {
         unsigned threadaddr;
-        hThread = (HANDLE) _beginthreadex(NULL,
+        threads[i] = (HANDLE) _beginthreadex(NULL,
             0,
             &startthread,
             this,
             0,
             (unsigned *)&threadaddr);
 
-        if (hThread)
+        if (threads[i])
         {
-            SetThreadPriority(hThread, THREAD_PRIORITY_HIGHEST);
+            SetThreadPriority(threads[i], THREAD_PRIORITY_HIGHEST);
         }
         else
         {
@@ -91,14 +122,33 @@ void AsyncRead::start()
 
 int AsyncRead::read(size_t i)
 {
-    FileData *f = &files[i];
+    EnterCriticalSection(&cs);
+    FileData *f = files[i];
+    LeaveCriticalSection(&cs);
     WaitForSingleObject(f->event, INFINITE);
-    Sleep(0);                   // give up time slice
     return f->result;
 }
 
 void AsyncRead::dispose(AsyncRead *aw)
 {
+    EnterCriticalSection(&aw->cs);
+    aw->quit = true;
+    LeaveCriticalSection(&aw->cs);
+    ReleaseSemaphore(aw->sem, (LONG)aw->nthreads, NULL);
+    for (size_t i = 0; i < aw->nthreads; i++)
+    {
+        WaitForSingleObject(aw->threads[i], INFINITE);
+        CloseHandle(aw->threads[i]);
+    }
+    for (size_t i = 0; i < aw->filesdim; i++)
+    {
+        CloseHandle(aw->files[i]->event);
+        free(aw->files[i]);
+    }
+    CloseHandle(aw->sem);
+    DeleteCriticalSection(&aw->cs);
+    free(aw->threads);
+    free(aw->files);
     free(aw);
 }
 
@@ -108,17 +158,139 @@ unsigned __stdcall startthread(void *p)
 {
     AsyncRead *aw = (AsyncRead *)p;
 
-    //printf("aw->filesdim = %p %d\n", aw, aw->filesdim);
-    for (size_t i = 0; i < aw->filesdim; i++)
-    {   FileData *f = &aw->files[i];
+    while (1)
+    {
+        WaitForSingleObject(aw->sem, INFINITE);
+        EnterCriticalSection(&aw->cs);
+        if (aw->next == aw->filesdim)
+        {   // woken by dispose()
+            assert(aw->quit);
+            LeaveCriticalSection(&aw->cs);
+            break;
+        }
+        FileData *f = aw->files[aw->next++];
+        LeaveCriticalSection(&aw->cs);
 
-        f->result = f->file->read();
+        f->result = f->file->mmread();
         SetEvent(f->event);
     }
     _endthreadex(EXIT_SUCCESS);
     return EXIT_SUCCESS;                // if skidding
 }
 
+/*******************************************/
+
+static unsigned __stdcall taskthread(void *p);
+
+struct TaskPool
+{
+    static TaskPool *create(size_t nthreads, size_t ntasks, TaskFp fp, void *arg);
+    void start();
+    void wait(size_t i);
+    static void dispose(TaskPool *);
+
+    TaskFp fp;
+    void *arg;
+    volatile LONG next;         // next task to hand out
+    size_t ntasks;
+    HANDLE *events;             // one per task, signalled when done
+    size_t nthreads;
+    HANDLE threads[1];
+};
+
+TaskPool *TaskPool::create(size_t nthreads, size_t ntasks, TaskFp fp, void *arg)
+{
+    assert(nthreads);
+    TaskPool *tp = (TaskPool *)calloc(1, sizeof(TaskPool) +
+                                (nthreads - 1) * sizeof(HANDLE));
+    tp->fp = fp;
+    tp->arg = arg;
+    tp->ntasks = ntasks;
+    tp->nthreads = nthreads;
+    tp->events = (HANDLE *)calloc(ntasks ? ntasks : 1, sizeof(HANDLE));
+    for (size_t i = 0; i < ntasks; i++)
+        tp->events[i] = CreateEvent(NULL, TRUE, FALSE, NULL);
+    return tp;
+}
+
+void TaskPool::start()
+{
+    for (size_t i = 0; i < nthreads; i++)
+    {
+        unsigned threadaddr;
+        threads[i] = (HANDLE) _beginthreadex(NULL,
+            0,
+            &taskthread,
+            this,
+            0,
+            (unsigned *)&threadaddr);
+        assert(threads[i]);
+    }
+}
+
+void TaskPool::wait(size_t i)
+{
+    WaitForSingleObject(events[i], INFINITE);
+}
+
+void TaskPool::dispose(TaskPool *tp)
+{
+    for (size_t i = 0; i < tp->nthreads; i++)
+    {
+        if (tp->threads[i])
+        {
+            WaitForSingleObject(tp->threads[i], INFINITE);
+            CloseHandle(tp->threads[i]);
+        }
+    }
+    for (size_t i = 0; i < tp->ntasks; i++)
+        CloseHandle(tp->events[i]);
+    free(tp->events);
+    free(tp);
+}
+
+unsigned __stdcall taskthread(void *p)
+{
+    TaskPool *tp = (TaskPool *)p;
+
+    while (1)
+    {
+        size_t i = (size_t)InterlockedIncrement(&tp->next) - 1;
+        if (i >= tp->ntasks)
+            break;
+        tp->fp(tp->arg, i);
+        SetEvent(tp->events[i]);
+    }
+    _endthreadex(EXIT_SUCCESS);
+    return EXIT_SUCCESS;                // if skidding
+}
+
+/*******************************************/
+
+Mutex::Mutex()
+{
+    CRITICAL_SECTION *cs = (CRITICAL_SECTION *)malloc(sizeof(CRITICAL_SECTION));
+    assert(cs);
+    InitializeCriticalSection(cs);
+    handle = cs;
+}
+
+Mutex::~Mutex()
+{
+    DeleteCriticalSection((CRITICAL_SECTION *)handle);
+    free(handle);
+}
+
+void Mutex::lock()
+{
+    EnterCriticalSection((CRITICAL_SECTION *)handle);
+}
+
+void Mutex::unlock()
+{
+    LeaveCriticalSection((CRITICAL_SECTION *)handle);
+}
+
 #elif __linux__  // Posix
 
 #include <errno.h>
@@ -126,6 +298,7 @@ unsigned __stdcall startthread(void *p)
 #include <time.h>
 
 #include "root.h"
+#include "thread.h"
 
 void *startthread(void *arg);
 
@@ -139,59 +312,108 @@ struct FileData
 {
     File *file;
     int result;
-
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
-    int value;
+    int value;                  // !=0 when read
 };
 
 struct AsyncRead
 {
     static AsyncRead *create(size_t nfiles);
-    void addFile(File *file);
-    void start();
+    size_t addFile(File *file);
+    void start(size_t nthreads);
     int read(size_t i);
     static void dispose(AsyncRead *);
 
+    pthread_mutex_t mutex;      // guards everything below
+    pthread_cond_t added;       // signalled when a file is added, or on quit
+    pthread_cond_t done;        // signalled when a file has been read
+    size_t next;                // next file to read
+    bool quit;
+
     size_t filesdim;
     size_t filesmax;
-    FileData files[1];
+    FileData **files;           // FileData's don't move when files grows
+
+    size_t nthreads;
+    pthread_t *threads;
 };
 
+static void lock(pthread_mutex_t *mutex)
+{
+    int status = pthread_mutex_lock(mutex);
+    if (status != 0)
+        err_abort(status, "lock mutex");
+}
 
-AsyncRead *AsyncRead::create(size_t nfiles)
+static void unlock(pthread_mutex_t *mutex)
 {
-    AsyncRead *aw = (AsyncRead *)calloc(1, sizeof(AsyncRead) +
-                                (nfiles - 1) * sizeof(FileData));
-    aw->filesmax = nfiles;
-    return aw;
+    int status = pthread_mutex_unlock(mutex);
+    if (status != 0)
+        err_abort(status, "unlock mutex");
 }
 
-void AsyncRead::addFile(File *file)
+
+AsyncRead *AsyncRead::create(size_t nfiles)
 {
-    //printf("addFile(file = %p)\n", file);
-    //printf("filesdim = %d, filesmax = %d\n", filesdim, filesmax);
-    assert(filesdim < filesmax);
-    FileData *f = &files[filesdim];
-    f->file = file;
+    AsyncRead *aw = (AsyncRead *)calloc(1, sizeof(AsyncRead));
+    aw->filesmax = nfiles ? nfiles : 1;
+    aw->files = (FileData **)malloc(aw->filesmax * sizeof(FileData *));
+    if (!aw->files)
+        err_abort(ENOMEM, "create");
 
-    int status = pthread_mutex_init(&f->mutex, NULL);
+    int status = pthread_mutex_init(&aw->mutex, NULL);
     if (status != 0)
         err_abort(status, "init mutex");
-    status = pthread_cond_init(&f->cond, NULL);
+    status = pthread_cond_init(&aw->added, NULL);
     if (status != 0)
         err_abort(status, "init cond");
+    status = pthread_cond_init(&aw->done, NULL);
+    if (status != 0)
+        err_abort(status, "init cond");
+    return aw;
+}
+
+/*******************************************
+ * Queue file to be read. Can be called before or after start().
+ * Returns:
+ *      index to pass to read()
+ */
+
+size_t AsyncRead::addFile(File *file)
+{
+    //printf("addFile(file = %p)\n", file);
+    FileData *f = (FileData *)calloc(1, sizeof(FileData));
+    if (!f)
+        err_abort(ENOMEM, "add file");
+    f->file = file;
 
-    filesdim++;
+    lock(&mutex);
+    if (filesdim == filesmax)
+    {
+        filesmax *= 2;
+        files = (FileData **)realloc(files, filesmax * sizeof(FileData *));
+        if (!files)
+            err_abort(ENOMEM, "add file");
+    }
+    size_t i = filesdim++;
+    files[i] = f;
+    int status = pthread_cond_signal(&added);
+    if (status != 0)
+        err_abort(status, "signal condition");
+    unlock(&mutex);
+    return i;
 }
 
-void AsyncRead::start()
+void AsyncRead::start(size_t nthreads)
 {
     //printf("aw->filesdim = %p %d\n", this, filesdim);
-    if (filesdim)
+    assert(nthreads);
+    this->nthreads = nthreads;
+    threads = (pthread_t *)calloc(nthreads, sizeof(pthread_t));
+    if (!threads)
+        err_abort(ENOMEM, "create thread");
+    for (size_t i = 0; i < nthreads; i++)
     {
-        pthread_t thread_id;
-        int status = pthread_create(&thread_id,
+        int status = pthread_create(&threads[i],
             NULL,
             &startthread,
             this);
@@ -202,21 +424,15 @@ void AsyncRead::start()
 
 int AsyncRead::read(size_t i)
 {
-    FileData *f = &files[i];
-
-    // Wait for the event
-    int status = pthread_mutex_lock(&f->mutex);
-    if (status != 0)
-        err_abort(status, "lock mutex");
+    lock(&mutex);
+    FileData *f = files[i];
     while (f->value == 0)
     {
-        status = pthread_cond_wait(&f->cond, &f->mutex);
+        int status = pthread_cond_wait(&done, &mutex);
         if (status != 0)
             err_abort(status, "wait on condition");
     }
-    status = pthread_mutex_unlock(&f->mutex);
-    if (status != 0)
-        err_abort(status, "unlock mutex");
+    unlock(&mutex);
 
     return f->result;
 }
@@ -224,16 +440,32 @@ int AsyncRead::read(size_t i)
 void AsyncRead::dispose(AsyncRead *aw)
 {
     //printf("AsyncRead::dispose()\n");
-    for (int i = 0; i < aw->filesdim; i++)
+    lock(&aw->mutex);
+    aw->quit = true;
+    int status = pthread_cond_broadcast(&aw->added);
+    if (status != 0)
+        err_abort(status, "broadcast condition");
+    unlock(&aw->mutex);
+
+    for (size_t i = 0; i < aw->nthreads; i++)
     {
-        FileData *f = &aw->files[i];
-        int status = pthread_cond_destroy(&f->cond);
-        if (status != 0)
-            err_abort(status, "cond destroy");
-        status = pthread_mutex_destroy(&f->mutex);
+        status = pthread_join(aw->threads[i], NULL);
         if (status != 0)
-            err_abort(status, "mutex destroy");
+            err_abort(status, "join thread");
     }
+    status = pthread_cond_destroy(&aw->done);
+    if (status != 0)
+        err_abort(status, "cond destroy");
+    status = pthread_cond_destroy(&aw->added);
+    if (status != 0)
+        err_abort(status, "cond destroy");
+    status = pthread_mutex_destroy(&aw->mutex);
+    if (status != 0)
+        err_abort(status, "mutex destroy");
+    for (size_t i = 0; i < aw->filesdim; i++)
+        free(aw->files[i]);
+    free(aw->files);
+    free(aw->threads);
     free(aw);
 }
 
@@ -242,22 +474,151 @@ void *startthread(void *p)
 {
     AsyncRead *aw = (AsyncRead *)p;
 
-    //printf("startthread: aw->filesdim = %p %d\n", aw, aw->filesdim);
-    size_t dim = aw->filesdim;
-    for (size_t i = 0; i < dim; i++)
-    {   FileData *f = &aw->files[i];
+    lock(&aw->mutex);
+    while (1)
+    {
+        while (aw->next == aw->filesdim && !aw->quit)
+        {
+            int status = pthread_cond_wait(&aw->added, &aw->mutex);
+            if (status != 0)
+                err_abort(status, "wait on condition");
+        }
+        if (aw->next == aw->filesdim)
+            break;                      // quit, and nothing left to read
+        FileData *f = aw->files[aw->next++];
+        unlock(&aw->mutex);
 
-        f->result = f->file->read();
+        int result = f->file->mmread();
 
-        // Set event
-        int status = pthread_mutex_lock(&f->mutex);
+        lock(&aw->mutex);
+        f->result = result;
+        f->value = 1;
+        int status = pthread_cond_broadcast(&aw->done);
+        if (status != 0)
+            err_abort(status, "broadcast condition");
+    }
+    unlock(&aw->mutex);
+
+    return NULL;                        // end thread
+}
+
+/*******************************************/
+
+void *taskthread(void *arg);
+
+struct TaskPool
+{
+    static TaskPool *create(size_t nthreads, size_t ntasks, TaskFp fp, void *arg);
+    void start();
+    void wait(size_t i);
+    static void dispose(TaskPool *);
+
+    TaskFp fp;
+    void *arg;
+    size_t next;                // next task to hand out
+    size_t ntasks;
+    unsigned char *done;        // one per task, !=0 when done
+
+    pthread_mutex_t mutex;      // guards next and done[]
+    pthread_cond_t cond;        // signalled when a task is done
+
+    size_t nthreads;
+    pthread_t threads[1];
+};
+
+TaskPool *TaskPool::create(size_t nthreads, size_t ntasks, TaskFp fp, void *arg)
+{
+    assert(nthreads);
+    TaskPool *tp = (TaskPool *)calloc(1, sizeof(TaskPool) +
+                                (nthreads - 1) * sizeof(pthread_t));
+    tp->fp = fp;
+    tp->arg = arg;
+    tp->ntasks = ntasks;
+    tp->nthreads = nthreads;
+    tp->done = (unsigned char *)calloc(ntasks ? ntasks : 1, 1);
+
+    int status = pthread_mutex_init(&tp->mutex, NULL);
+    if (status != 0)
+        err_abort(status, "init mutex");
+    status = pthread_cond_init(&tp->cond, NULL);
+    if (status != 0)
+        err_abort(status, "init cond");
+    return tp;
+}
+
+void TaskPool::start()
+{
+    for (size_t i = 0; i < nthreads; i++)
+    {
+        int status = pthread_create(&threads[i],
+            NULL,
+            &taskthread,
+            this);
+        if (status != 0)
+            err_abort(status, "create thread");
+    }
+}
+
+void TaskPool::wait(size_t i)
+{
+    int status = pthread_mutex_lock(&mutex);
+    if (status != 0)
+        err_abort(status, "lock mutex");
+    while (!done[i])
+    {
+        status = pthread_cond_wait(&cond, &mutex);
+        if (status != 0)
+            err_abort(status, "wait on condition");
+    }
+    status = pthread_mutex_unlock(&mutex);
+    if (status != 0)
+        err_abort(status, "unlock mutex");
+}
+
+void TaskPool::dispose(TaskPool *tp)
+{
+    for (size_t i = 0; i < tp->nthreads; i++)
+    {
+        int status = pthread_join(tp->threads[i], NULL);
+        if (status != 0)
+            err_abort(status, "join thread");
+    }
+    int status = pthread_cond_destroy(&tp->cond);
+    if (status != 0)
+        err_abort(status, "cond destroy");
+    status = pthread_mutex_destroy(&tp->mutex);
+    if (status != 0)
+        err_abort(status, "mutex destroy");
+    free(tp->done);
+    free(tp);
+}
+
+void *taskthread(void *arg)
+{
+    TaskPool *tp = (TaskPool *)arg;
+
+    while (1)
+    {
+        int status = pthread_mutex_lock(&tp->mutex);
         if (status != 0)
             err_abort(status, "lock mutex");
-        f->value = 1;
-        status = pthread_cond_signal(&f->cond);
+        size_t i = tp->next++;
+        status = pthread_mutex_unlock(&tp->mutex);
         if (status != 0)
-            err_abort(status, "signal condition");
-        status = pthread_mutex_unlock(&f->mutex);
+            err_abort(status, "unlock mutex");
+        if (i >= tp->ntasks)
+            break;
+
+        tp->fp(tp->arg, i);
+
+        status = pthread_mutex_lock(&tp->mutex);
+        if (status != 0)
+            err_abort(status, "lock mutex");
+        tp->done[i] = 1;
+        status = pthread_cond_broadcast(&tp->cond);
+        if (status != 0)
+            err_abort(status, "broadcast condition");
+        status = pthread_mutex_unlock(&tp->mutex);
         if (status != 0)
             err_abort(status, "unlock mutex");
     }
@@ -265,69 +626,170 @@ void *startthread(void *p)
     return NULL;                        // end thread
 }
 
+/*******************************************/
+
+Mutex::Mutex()
+{
+    pthread_mutex_t *m = (pthread_mutex_t *)malloc(sizeof(pthread_mutex_t));
+    if (!m)
+        err_abort(ENOMEM, "init mutex");
+    int status = pthread_mutex_init(m, NULL);
+    if (status != 0)
+        err_abort(status, "init mutex");
+    handle = m;
+}
+
+Mutex::~Mutex()
+{
+    pthread_mutex_destroy((pthread_mutex_t *)handle);
+    free(handle);
+}
+
+void Mutex::lock()
+{
+    int status = pthread_mutex_lock((pthread_mutex_t *)handle);
+    if (status != 0)
+        err_abort(status, "lock mutex");
+}
+
+void Mutex::unlock()
+{
+    int status = pthread_mutex_unlock((pthread_mutex_t *)handle);
+    if (status != 0)
+        err_abort(status, "unlock mutex");
+}
+
 #else
 
 #include <stdio.h>
 #include <errno.h>
 
 #include "root.h"
+#include "thread.h"
 
 struct FileData
 {
     File *file;
     int result;
-    //HANDLE event;
+    bool done;          // read() is done, don't read it again
 };
 
 struct AsyncRead
 {
     static AsyncRead *create(size_t nfiles);
-    void addFile(File *file);
-    void start();
+    size_t addFile(File *file);
+    void start(size_t nthreads);
     int read(size_t i);
     static void dispose(AsyncRead *);
 
-    //HANDLE hThread;
-
     size_t filesdim;
     size_t filesmax;
-    FileData files[1];
+    FileData *files;
 };
 
 
 AsyncRead *AsyncRead::create(size_t nfiles)
 {
-    AsyncRead *aw = (AsyncRead *)calloc(1, sizeof(AsyncRead) +
-                                (nfiles - 1) * sizeof(FileData));
-    aw->filesmax = nfiles;
+    AsyncRead *aw = (AsyncRead *)calloc(1, sizeof(AsyncRead));
+    aw->filesmax = nfiles ? nfiles : 1;
+    aw->files = (FileData *)calloc(aw->filesmax, sizeof(FileData));
     return aw;
 }
 
-void AsyncRead::addFile(File *file)
+size_t AsyncRead::addFile(File *file)
 {
     //printf("addFile(file = %p)\n", file);
-    //printf("filesdim = %d, filesmax = %d\n", filesdim, filesmax);
-    assert(filesdim < filesmax);
-    files[filesdim].file = file;
-    //files[filesdim].event = CreateEvent(NULL, TRUE, FALSE, NULL);
-    //ResetEvent(files[filesdim].event);
-    filesdim++;
+    if (filesdim == filesmax)
+    {
+        filesmax *= 2;
+        files = (FileData *)realloc(files, filesmax * sizeof(FileData));
+        assert(files);
+    }
+    FileData *f = &files[filesdim];
+    f->file = file;
+    f->done = false;
+    return filesdim++;
 }
 
-void AsyncRead::start()
+void AsyncRead::start(size_t nthreads)
 {
 }
 
 int AsyncRead::read(size_t i)
 {
     FileData *f = &files[i];
-    f->result = f->file->read();
+    if (!f->done)
+    {
+        f->result = f->file->mmread();
+        f->done = true;
+    }
     return f->result;
 }
 
 void AsyncRead::dispose(AsyncRead *aw)
 {
+    free(aw->files);
     free(aw);
 }
 
+/*******************************************/
+
+// No threads: run each task when it is waited on
+
+struct TaskPool
+{
+    static TaskPool *create(size_t nthreads, size_t ntasks, TaskFp fp, void *arg);
+    void start();
+    void wait(size_t i);
+    static void dispose(TaskPool *);
+
+    TaskFp fp;
+    void *arg;
+    size_t next;                // tasks below next are done
+    size_t ntasks;
+};
+
+TaskPool *TaskPool::create(size_t nthreads, size_t ntasks, TaskFp fp, void *arg)
+{
+    TaskPool *tp = (TaskPool *)calloc(1, sizeof(TaskPool));
+    tp->fp = fp;
+    tp->arg = arg;
+    tp->ntasks = ntasks;
+    return tp;
+}
+
+void TaskPool::start()
+{
+}
+
+void TaskPool::wait(size_t i)
+{
+    for (; next <= i; next++)
+        fp(arg, next);
+}
+
+void TaskPool::dispose(TaskPool *tp)
+{
+    free(tp);
+}
+
+/*******************************************/
+
+Mutex::Mutex()
+{
+    handle = NULL;
+}
+
+Mutex::~Mutex()
+{
+}
+
+void Mutex::lock()
+{
+}
+
+void Mutex::unlock()
+{
+}
+
 #endif
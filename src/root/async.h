@@ -16,18 +16,35 @@
 
 
 /*******************
- * Simple interface to read files asynchronously in another
- * thread.
+ * Simple interface to read files asynchronously on a pool
+ * of threads. Files are read in the order they are added,
+ * and more can be added after start().
  */
 
 struct AsyncRead
 {
-    static AsyncRead *create(size_t nfiles);
-    void addFile(File *file);
-    void start();
+    static AsyncRead *create(size_t nfiles);     // nfiles is a hint
+    size_t addFile(File *file);                  // returns index for read()
+    void start(size_t nthreads);
     int read(size_t i);
     static void dispose(AsyncRead *);
 };
 
+/*******************
+ * Run tasks 0 .. ntasks-1 on a pool of worker threads.
+ * Tasks are handed out in order, so waiting on them in
+ * order keeps the pipeline full.
+ */
+
+typedef void (*TaskFp)(void *arg, size_t i);
+
+struct TaskPool
+{
+    static TaskPool *create(size_t nthreads, size_t ntasks, TaskFp fp, void *arg);
+    void start();
+    void wait(size_t i);        // block until task i is done
+    static void dispose(TaskPool *);
+};
+
 
 #endif
@@ -31,12 +31,113 @@
 #include <errno.h>
 #include <unistd.h>
 #include <utime.h>
+#include <signal.h>
+#include <sys/mman.h>
 #endif
 
 #include "filename.h"
 #include "array.h"
 #include "port.h"
 #include "rmem.h"
+#include "thread.h"
+
+#if POSIX
+/* The files mmread() has mapped, by device and inode. write() replaces
+ * these rather than overwriting them, which would change what the
+ * private mappings see, or leave them past the end of the file.
+ */
+struct MappedFile
+{
+    dev_t dev;
+    ino_t ino;
+    void *addr;
+    size_t len;
+};
+
+static MappedFile *mappedFiles;
+static size_t mappedDim;
+static size_t mappedAllocdim;
+static Mutex mappedLock;        // mmread() is called on worker threads too
+static struct sigaction oldBusAction;   // put back when nothing is mapped
+
+/* A mapped file that another process truncates raises SIGBUS when a page
+ * past its new end is touched. Say so rather than just dumping core.
+ * Any other SIGBUS is left to whoever handled it before.
+ */
+static void busError(int sig, siginfo_t *info, void *context)
+{
+    char *a = (char *)info->si_addr;
+    for (size_t i = 0; info->si_code > 0 && i < mappedDim; i++)    // not sent by kill()
+    {
+        char *p = (char *)mappedFiles[i].addr;
+        if (p <= a && a < p + mappedFiles[i].len)
+        {
+            static const char msg[] = "Error: an input file was truncated while it was being read\n";
+            ssize_t n = ::write(2, msg, sizeof(msg) - 1);
+            (void)n;
+            _exit(EXIT_FAILURE);
+        }
+    }
+    sigaction(SIGBUS, &oldBusAction, NULL);
+    raise(sig);
+}
+
+static void addMapped(struct stat *st, void *addr, size_t len)
+{
+    mappedLock.lock();
+    if (!mappedDim)
+    {
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_sigaction = &busError;
+        sa.sa_flags = SA_SIGINFO;
+        sigaction(SIGBUS, &sa, &oldBusAction);
+    }
+    if (mappedDim == mappedAllocdim)
+    {
+        mappedAllocdim = mappedAllocdim ? mappedAllocdim * 2 : 64;
+        mappedFiles = (MappedFile *)mem.realloc(mappedFiles, mappedAllocdim * sizeof(MappedFile));
+    }
+    mappedFiles[mappedDim].dev = st->st_dev;
+    mappedFiles[mappedDim].ino = st->st_ino;
+    mappedFiles[mappedDim].addr = addr;
+    mappedFiles[mappedDim].len = len;
+    mappedDim++;
+    mappedLock.unlock();
+}
+
+static void removeMapped(void *addr)
+{
+    mappedLock.lock();
+    for (size_t i = 0; i < mappedDim; i++)
+    {
+        if (mappedFiles[i].addr == addr)
+        {
+            mappedFiles[i] = mappedFiles[--mappedDim];
+            if (!mappedDim)
+                sigaction(SIGBUS, &oldBusAction, NULL);
+            break;
+        }
+    }
+    mappedLock.unlock();
+}
+
+static bool isMapped(struct stat *st)
+{
+    bool found = false;
+    mappedLock.lock();
+    for (size_t i = 0; i < mappedDim; i++)
+    {
+        if (mappedFiles[i].ino == st->st_ino && mappedFiles[i].dev == st->st_dev)
+        {
+            found = true;
+            break;
+        }
+    }
+    mappedLock.unlock();
+    return found;
+}
+#endif
 
 /****************************** File ********************************/
 
@@ -64,18 +165,35 @@ File::File(const char *n)
 }
 
 File::~File()
+{
+    freebuffer();
+    if (touchtime)
+        mem.free(touchtime);
+}
+
+/*************************************
+ * Release the data read in, unless it is someone else's.
+ */
+
+void File::freebuffer()
 {
     if (buffer)
     {
         if (ref == 0)
             mem.free(buffer);
-#if _WIN32
         if (ref == 2)
+        {
+#if _WIN32
             UnmapViewOfFile(buffer);
+#elif POSIX
+            removeMapped(buffer);
+            munmap(buffer, len);
 #endif
+        }
     }
-    if (touchtime)
-        mem.free(touchtime);
+    buffer = NULL;
+    len = 0;
+    ref = 0;
 }
 
 /*************************************
@@ -214,17 +332,52 @@ err1:
 
 /*****************************
  * Read a file with memory mapped file I/O.
+ * The mapping is private, so the buffer can be written to like
+ * the one read() fills in. As with read(), the buffer is followed
+ * by two 0's, which is the rest of the last page; if there isn't
+ * room for them, the file is read instead.
  */
 
 int File::mmread()
 {
+    if (len)
+        return 0;               // already read the file
 #if POSIX
-    return read();
+    struct stat buf;
+    char *name = this->name->toChars();
+    int fd = open(name, O_RDONLY);
+    if (fd == -1)
+        return 1;
+    if (fstat(fd, &buf))
+    {
+        close(fd);
+        return 1;
+    }
+
+    size_t size = (size_t)buf.st_size;
+    size_t pagesize = (size_t)sysconf(_SC_PAGESIZE);
+    void *p = MAP_FAILED;
+    if (S_ISREG(buf.st_mode) && size && size % pagesize && size % pagesize <= pagesize - 2)
+        p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        return read();
+    addMapped(&buf, p, size);
+
+    if (!ref)
+        ::free(buffer);
+    ref = 2;
+    buffer = (unsigned char *)p;
+    len = size;
+    if (touchtime)
+        memcpy(touchtime, &buf, sizeof(buf));
+    return 0;
 #elif _WIN32
     HANDLE hFile;
     HANDLE hFileMap;
     DWORD size;
     char *name;
+    SYSTEM_INFO si;
 
     name = this->name->toChars();
     hFile = CreateFileA(name, GENERIC_READ,
@@ -235,7 +388,14 @@ int File::mmread()
     size = GetFileSize(hFile, NULL);
     //printf(" file created, size %d\n", size);
 
-    hFileMap = CreateFileMappingA(hFile,NULL,PAGE_READONLY,0,size,NULL);
+    GetSystemInfo(&si);
+    if (!size || !(size % si.dwPageSize) || size % si.dwPageSize > si.dwPageSize - 2)
+    {
+        CloseHandle(hFile);
+        return read();
+    }
+
+    hFileMap = CreateFileMappingA(hFile,NULL,PAGE_WRITECOPY,0,size,NULL);
     if (CloseHandle(hFile) != TRUE)
         goto Lerr;
 
@@ -247,7 +407,7 @@ int File::mmread()
     if (!ref)
         mem.free(buffer);
     ref = 2;
-    buffer = (unsigned char *)MapViewOfFileEx(hFileMap, FILE_MAP_READ,0,0,size,NULL);
+    buffer = (unsigned char *)MapViewOfFileEx(hFileMap, FILE_MAP_COPY,0,0,size,NULL);
     if (CloseHandle(hFileMap) != TRUE)
         goto Lerr;
     if (buffer == NULL)                 // mapping view failed
@@ -273,12 +433,22 @@ Lerr:
 
 int File::write()
 {
+    FileName::clearCache();     // it may be a new file
 #if POSIX
     int fd;
     ssize_t numwritten;
     char *name;
 
     name = this->name->toChars();
+
+    /* Replace rather than overwrite a file mmread() has mapped, maybe
+     * an input library, so that the mapping keeps the old contents.
+     * Any other file is overwritten, keeping its links and mode.
+     */
+    {   struct stat st;
+        if (lstat(name, &st) == 0 && S_ISREG(st.st_mode) && isMapped(&st))
+            ::remove(name);
+    }
     fd = open(name, O_CREAT | O_WRONLY | O_TRUNC, 0644);
     if (fd == -1)
         goto err;
@@ -24,7 +24,8 @@ struct FileName;
 
 struct File
 {
-    int ref;                    // != 0 if this is a reference to someone else's buffer
+    int ref;                    // != 0 if this is a reference to someone else's buffer,
+                                // 2 if it is mapped by mmread()
     unsigned char *buffer;      // data for our file
     size_t len;                 // amount of data in buffer[]
     void *touchtime;            // system time to use for file
@@ -48,6 +49,12 @@ struct File
 
     int mmread();
 
+    /* Free or unmap the buffer, unless it is someone else's,
+     * and forget it
+     */
+
+    void freebuffer();
+
     /* Write file, return !=0 if error
      */
 
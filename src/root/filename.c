@@ -16,6 +16,7 @@
 #include "array.h"
 #include "file.h"
 #include "rmem.h"
+#include "stringtable.h"
 
 #if defined (__sun)
 #include <alloca.h>
@@ -39,6 +40,7 @@
 #include <errno.h>
 #include <unistd.h>
 #include <utime.h>
+#include <dirent.h>
 #endif
 
 /****************************** FileName ********************************/
@@ -565,6 +567,175 @@ int FileName::exists(const char *name)
 #endif
 }
 
+/*************************************
+ * Directory listings read by existsCached(), by directory name
+ * including the trailing separator ("" for the current directory).
+ */
+
+#if _WIN32 || __APPLE__
+#define CASE_INSENSITIVE 1      // file systems usually are
+#endif
+
+struct DirEntry
+{
+    int kind;                   // as exists() returns, or -1 if not known yet
+    const char *name;           // as listed
+};
+
+struct DirListing
+{
+    StringTable entries;        // DirEntry's, by name (lower case if CASE_INSENSITIVE)
+    bool complete;              // false if the directory couldn't be listed
+};
+
+static StringTable dirListings;
+static bool dirListingsInit;
+
+size_t FileName::dirsListed;
+size_t FileName::statsSaved;
+
+static void addEntry(DirListing *dl, const char *name, int kind)
+{
+    size_t len = strlen(name);
+#if CASE_INSENSITIVE
+    char *key = (char *)alloca(len);
+    for (size_t i = 0; i < len; i++)
+        key[i] = tolower((unsigned char)name[i]);
+#else
+    const char *key = name;
+#endif
+    StringValue *sv = dl->entries.update(key, len);
+    if (!sv->ptrvalue)
+    {
+        DirEntry *de = (DirEntry *)mem.malloc(sizeof(DirEntry));
+        de->kind = kind;
+        de->name = mem.strdup(name);
+        sv->ptrvalue = de;
+    }
+}
+
+static DirListing *listDirectory(const char *dir, size_t dirlen)
+{
+    if (!dirListingsInit)
+    {
+        dirListings._init();
+        dirListingsInit = true;
+    }
+    StringValue *sv = dirListings.update(dir, dirlen);
+    if (sv->ptrvalue)
+        return (DirListing *)sv->ptrvalue;
+
+    DirListing *dl = new DirListing();
+    dl->entries._init();
+    dl->complete = true;
+    sv->ptrvalue = dl;
+    FileName::dirsListed++;
+
+#if POSIX
+    const char *d = dirlen ? sv->toDchars() : ".";
+    DIR *dp = opendir(d);
+    if (!dp)
+    {
+        // Only a directory that doesn't exist has no entries
+        dl->complete = errno == ENOENT || errno == ENOTDIR;
+        return dl;
+    }
+    while (struct dirent *e = readdir(dp))
+    {
+        int kind = -1;
+#ifdef DT_DIR
+        if (e->d_type == DT_REG)
+            kind = 1;
+        else if (e->d_type == DT_DIR)
+            kind = 2;
+#endif
+        addEntry(dl, e->d_name, kind);
+    }
+    closedir(dp);
+#elif _WIN32
+    char *pattern = (char *)alloca(dirlen + 2);
+    memcpy(pattern, dir, dirlen);
+    strcpy(pattern + dirlen, "*");
+    WIN32_FIND_DATAA fileinfo;
+    HANDLE h = FindFirstFileA(pattern, &fileinfo);
+    if (h == INVALID_HANDLE_VALUE)
+    {
+        DWORD err = GetLastError();
+        dl->complete = err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND;
+        return dl;
+    }
+    do
+    {
+        int kind = -1;
+        if (!(fileinfo.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+            kind = (fileinfo.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? 2 : 1;
+        addEntry(dl, fileinfo.cFileName, kind);
+    } while (FindNextFileA(h, &fileinfo));
+    FindClose(h);
+#else
+    assert(0);
+#endif
+    return dl;
+}
+
+/*************************************
+ * Same as exists(), but answered from a listing of the directory,
+ * which is read the first time a file in it is asked for. Meant for
+ * searching the import path, where most of the files asked for
+ * aren't there. Files created since the directory was listed are
+ * missed until clearCache() is called.
+ */
+
+int FileName::existsCached(const char *name)
+{
+    const char *n = FileName::name(name);
+    size_t dirlen = n - name;
+    size_t len = strlen(n);
+    if (!len)
+        return exists(name);
+
+    DirListing *dl = listDirectory(name, dirlen);
+    if (!dl->complete)
+        return exists(name);
+
+#if CASE_INSENSITIVE
+    char *key = (char *)alloca(len);
+    for (size_t i = 0; i < len; i++)
+        key[i] = tolower((unsigned char)n[i]);
+#else
+    const char *key = n;
+#endif
+    StringValue *sv = dl->entries.lookup(key, len);
+    if (!sv)
+    {
+        statsSaved++;
+        return 0;
+    }
+    DirEntry *de = (DirEntry *)sv->ptrvalue;
+#if __APPLE__
+    /* Only a differently cased match; whether it counts
+     * depends on the file system
+     */
+    if (strcmp(de->name, n) != 0)
+        return exists(name);
+#endif
+    if (de->kind == -1)         // a symbolic link or the like
+        de->kind = exists(name);
+    else
+        statsSaved++;
+    return de->kind;
+}
+
+/*************************************
+ * Forget the directory listings read by existsCached(),
+ * as files have been written.
+ */
+
+void FileName::clearCache()
+{
+    dirListingsInit = false;
+}
+
 int FileName::ensurePathExists(const char *path)
 {
     //printf("FileName::ensurePathExists(%s)\n", path ? path : "");
@@ -49,6 +49,10 @@ struct FileName
     static const char *searchPath(Strings *path, const char *name, int cwd);
     static const char *safeSearchPath(Strings *path, const char *name);
     static int exists(const char *name);
+    static int existsCached(const char *name);
+    static void clearCache();
+    static size_t dirsListed;   // by existsCached()
+    static size_t statsSaved;   // by existsCached()
     static int ensurePathExists(const char *path);
     static const char *canonicalName(const char *name);
 
@@ -16,6 +16,39 @@
 /* This implementation of the storage allocator uses the standard C allocation package.
  */
 
+#if _WIN32
+#include <windows.h>
+#define THREADLOCAL __declspec(thread)
+#elif __linux__
+#define THREADLOCAL __thread
+#else
+#define THREADLOCAL                     // no worker threads, see async.c
+#endif
+
+/* For the counters that all threads share
+ */
+#if _WIN64
+#define atomicAdd(p, n)     ((size_t)InterlockedExchangeAdd64((volatile LONGLONG *)(p), (LONGLONG)(n)) + (n))
+#define atomicCas(p, o, n)  (InterlockedCompareExchange64((volatile LONGLONG *)(p), (LONGLONG)(n), (LONGLONG)(o)) == (LONGLONG)(o))
+#elif _WIN32
+#define atomicAdd(p, n)     ((size_t)InterlockedExchangeAdd((volatile LONG *)(p), (LONG)(n)) + (n))
+#define atomicCas(p, o, n)  (InterlockedCompareExchange((volatile LONG *)(p), (LONG)(n), (LONG)(o)) == (LONG)(o))
+#elif __GNUC__
+#define atomicAdd(p, n)     __sync_add_and_fetch(p, n)
+#define atomicCas(p, o, n)  __sync_bool_compare_and_swap(p, o, n)
+#else
+#define atomicAdd(p, n)     (*(p) += (n))
+#define atomicCas(p, o, n)  (*(p) = (n), true)
+#endif
+
+/* Bytes handed out by new, Mem::malloc, Mem::calloc, Mem::mallocdup
+ * and Mem::strdup. realloc and free are not tracked.
+ */
+static THREADLOCAL size_t nallocated = 0;
+
+// Incremented by keepRegions()
+static THREADLOCAL unsigned nkept = 0;
+
 Mem mem;
 
 char *Mem::strdup(const char *s)
@@ -26,7 +59,10 @@ char *Mem::strdup(const char *s)
     {
         p = ::strdup(s);
         if (p)
+        {
+            nallocated += strlen(p) + 1;
             return p;
+        }
         error();
     }
     return NULL;
@@ -42,6 +78,7 @@ void *Mem::malloc(size_t size)
         p = ::malloc(size);
         if (!p)
             error();
+        nallocated += size;
     }
     return p;
 }
@@ -56,6 +93,7 @@ void *Mem::calloc(size_t size, size_t n)
         p = ::calloc(size, n);
         if (!p)
             error();
+        nallocated += size * n;
     }
     return p;
 }
@@ -104,6 +142,7 @@ void *Mem::mallocdup(void *o, size_t size)
             error();
         else
             memcpy(p,o,size);
+        nallocated += size;
     }
     return p;
 }
@@ -114,6 +153,46 @@ void Mem::error()
     exit(EXIT_FAILURE);
 }
 
+size_t Mem::allocated()
+{
+    return nallocated;
+}
+
+/* Bytes in the chunks of operator new on all threads, now and at most.
+ * release() gives chunks back, so these are not the same.
+ */
+static volatile size_t heapsize = 0;
+static volatile size_t heappeak = 0;
+
+static void heapGrow(size_t n)
+{
+    size_t size = atomicAdd(&heapsize, n);
+    size_t peak;
+    while ((peak = heappeak) < size && !atomicCas(&heappeak, peak, size))
+        ;
+}
+
+size_t Mem::heapSize()
+{
+    return heapsize;
+}
+
+size_t Mem::heapPeak()
+{
+    return heappeak;
+}
+
+/***********************************
+ * Note that data which outlives any region started so far with mark()
+ * may now point into it. Call when such data is created or changed,
+ * so that release() can tell whether it is safe to free a region.
+ */
+
+void Mem::keepRegions()
+{
+    nkept++;
+}
+
 /* =================================================== */
 
 #if defined(__has_feature)
@@ -126,20 +205,67 @@ void Mem::error()
 
 #if 1
 
-/* Allocate, but never release
+/* Allocate, but never release, except for regions (see Mem::mark())
  */
 
 // Allocate a little less than 1Mb because the C runtime adds some overhead that
 // causes the actual memory block to be larger than 1Mb otherwise.
 #define CHUNK_SIZE (256 * 4096 - 64)
 
-static size_t heapleft = 0;
-static void *heapp;
+#define HEAP_REGIONS 1
+
+/* Chunks are linked newest first, so that Mem::release() can free the
+ * ones allocated since the matching Mem::mark().
+ */
+struct Chunk
+{
+    Chunk *prev;
+    size_t size;                // not counting the header
+};
+
+#define CHUNK_HEADER ((sizeof(Chunk) + 15) & ~15)
+
+/* Each thread allocates from its own chunk, so worker threads
+ * (see TaskPool) can create AST nodes and Identifiers without locking.
+ */
+static THREADLOCAL size_t heapleft = 0;
+static THREADLOCAL void *heapp;
+static THREADLOCAL Chunk *chunks;
+
+static void *newChunk(size_t size)
+{
+    Chunk *c = (Chunk *)malloc(CHUNK_HEADER + size);
+    if (!c)
+    {
+        printf("Error: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    c->prev = chunks;
+    c->size = size;
+    chunks = c;
+    heapGrow(CHUNK_HEADER + size);
+    return (char *)c + CHUNK_HEADER;
+}
 
 void * operator new(size_t m_size)
 {
-    // 16 byte alignment is better (and sometimes needed) for doubles
-    m_size = (m_size + 15) & ~15;
+    /* 16 byte alignment is better (and sometimes needed) for doubles,
+     * but only objects whose size is a multiple of 16 can need it.
+     * The rest are packed on 8 byte boundaries, so AST nodes of
+     * 40, 56, 72 ... bytes don't each waste 8 bytes.
+     */
+    m_size = (m_size + 7) & ~7;
+    if (!(m_size & 15) && ((size_t)heapp & 15))
+    {
+        if (heapleft < 8)
+            heapleft = 0;
+        else
+        {
+            heapleft -= 8;
+            heapp = (void *)((char *)heapp + 8);
+        }
+    }
+    nallocated += m_size;
 
     // The layout of the code is selected so the most common case is straight through
     if (m_size <= heapleft)
@@ -151,23 +277,11 @@ void * operator new(size_t m_size)
         return p;
     }
 
-    if (m_size > CHUNK_SIZE)
-    {
-        void *p = malloc(m_size);
-        if (p)
-            return p;
-        printf("Error: out of memory\n");
-        exit(EXIT_FAILURE);
-        return p;
-    }
+    if (m_size > CHUNK_SIZE - CHUNK_HEADER)
+        return newChunk(m_size);
 
-    heapleft = CHUNK_SIZE;
-    heapp = malloc(CHUNK_SIZE);
-    if (!heapp)
-    {
-        printf("Error: out of memory\n");
-        exit(EXIT_FAILURE);
-    }
+    heapleft = CHUNK_SIZE - CHUNK_HEADER;
+    heapp = newChunk(heapleft);
     goto L1;
 }
 
@@ -175,11 +289,81 @@ void operator delete(void *p)
 {
 }
 
+/***********************************
+ * Start a region: memory from operator new on this thread from now
+ * until the matching release() can be freed all at once.
+ * Regions nest.
+ */
+
+MemRegion Mem::mark()
+{
+    MemRegion r;
+    r.chunks = chunks;
+    r.heapp = heapp;
+    r.heapleft = heapleft;
+    r.kept = nkept;
+    return r;
+}
+
+/***********************************
+ * Free the memory allocated by operator new on this thread since
+ * mark() returned r, unless keepRegions() was called since.
+ * Returns:
+ *      true if it was freed
+ */
+
+bool Mem::release(MemRegion *r)
+{
+    if (r->kept != nkept)
+        return false;
+
+    bool samechunk = true;
+    while (chunks != r->chunks)
+    {
+        Chunk *c = chunks;
+        chunks = c->prev;
+        atomicAdd(&heapsize, -(CHUNK_HEADER + c->size));
+        if ((char *)heapp >= (char *)c && (char *)heapp <= (char *)c + CHUNK_HEADER + c->size)
+            samechunk = false;
+#ifdef DEBUG
+        memset(c, 0xDD, CHUNK_HEADER + c->size);
+#endif
+        free(c);
+    }
+#ifdef DEBUG
+    // The rest of r's chunk, or what of it was used since
+    if (r->heapp)
+        memset(r->heapp, 0xDD, r->heapleft - (samechunk ? heapleft : 0));
+#endif
+    heapp = r->heapp;
+    heapleft = r->heapleft;
+    return true;
+}
+
+/***********************************
+ * Returns:
+ *      true if p is memory operator new handed out on this thread
+ *      since mark() returned r, and release(r) would free
+ */
+
+bool Mem::inRegion(MemRegion *r, void *p)
+{
+    char *q = (char *)p;
+    for (Chunk *c = chunks; c != r->chunks; c = c->prev)
+    {
+        char *start = (char *)c + CHUNK_HEADER;
+        if (q >= start && q < start + c->size)
+            return true;
+    }
+    return r->heapp && q >= (char *)r->heapp && q < (char *)r->heapp + r->heapleft;
+}
+
 #else
 
 void * operator new(size_t m_size)
 {
     void *p = malloc(m_size);
+    nallocated += m_size;
     if (p)
         return p;
     printf("Error: out of memory\n");
@@ -195,3 +379,24 @@ void operator delete(void *p)
 #endif
 
 #endif
+
+#if !HEAP_REGIONS
+
+MemRegion Mem::mark()
+{
+    MemRegion r;
+    memset(&r, 0, sizeof(r));
+    return r;
+}
+
+bool Mem::release(MemRegion *r)
+{
+    return false;
+}
+
+bool Mem::inRegion(MemRegion *r, void *p)
+{
+    return false;
+}
+
+#endif
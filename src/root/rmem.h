@@ -12,6 +12,16 @@
 
 #include <stddef.h>     // for size_t
 
+/* Where operator new has got to on this thread, see Mem::mark().
+ */
+struct MemRegion
+{
+    void *chunks;
+    void *heapp;
+    size_t heapleft;
+    unsigned kept;
+};
+
 struct Mem
 {
     Mem() { }
@@ -23,6 +33,28 @@ struct Mem
     void free(void *p);
     void *mallocdup(void *o, size_t size);
     void error();
+    size_t allocated();         // bytes allocated so far by this thread
+    size_t heapSize();          // bytes operator new holds now, on all threads
+    size_t heapPeak();          // the most heapSize() has been
+
+    /* Regions. release() frees what operator new handed out on this
+     * thread since mark(), unless keepRegions() was called since. That
+     * is only safe while nothing older than the region points into it,
+     * so keepRegions() must be called whenever such a pointer may be
+     * made:
+     *  - by the constructors of Type, Dsymbol, Statement, Initializer,
+     *    Scope and Identifier, since whoever creates one links it into
+     *    the AST, the type table or the string table
+     *  - by any code that stores into an AST node, or into a table that
+     *    lasts, which was there before the region started
+     * Only ctfeInterpret() uses regions. Gagged template instantiations
+     * don't: one that fails is taken out of its template's instances,
+     * but the instances and types it created stay, and point into it.
+     */
+    MemRegion mark();
+    bool release(MemRegion *r);
+    bool inRegion(MemRegion *r, void *p);
+    void keepRegions();
 };
 
 extern Mem mem;
@@ -17,56 +17,39 @@
 #include "stringtable.h"
 
 // TODO: Merge with root.String
+static inline uint64_t rotl(uint64_t x, int n)
+{
+    return (x << n) | (x >> (64 - n));
+}
+
+/**********************************
+ * Hash 8 bytes at a time, mixing in each word with a rotate, xor
+ * and multiply, and finishing so that the low bits, which index
+ * the table, depend on all of the input.
+ */
+
 hash_t calcHash(const char *str, size_t len)
 {
-    hash_t hash = 0;
+    const uint64_t m = 0x9E3779B97F4A7C15ULL;
+    uint64_t hash = len * m;
+    uint64_t w;
 
-    union
+    for (; len >= 8; str += 8, len -= 8)
     {
-        uint8_t  scratchB[4];
-        uint16_t scratchS[2];
-        uint32_t scratchI;
-    };
-    
-    while (1)
+        memcpy(&w, str, 8);
+        hash = (rotl(hash, 5) ^ w) * m;
+    }
+    if (len)
     {
-        switch (len)
-        {
-            case 0:
-                return hash;
-
-            case 1:
-                hash *= 37;
-                hash += *(const uint8_t *)str;
-                return hash;
-
-            case 2:
-                hash *= 37;
-                scratchB[0] = str[0];
-                scratchB[1] = str[1];
-                hash += scratchS[0];
-                return hash;
-
-            case 3:
-                hash *= 37;
-                scratchB[0] = str[0];
-                scratchB[1] = str[1];
-                hash += (scratchS[0] << 8) +
-                        ((const uint8_t *)str)[2];
-                return hash;
-
-            default:
-                hash *= 37;
-                scratchB[0] = str[0];
-                scratchB[1] = str[1];
-                scratchB[2] = str[2];
-                scratchB[3] = str[3];
-                hash += scratchI;
-                str += 4;
-                len -= 4;
-                break;
-        }
+        w = 0;
+        memcpy(&w, str, len);
+        hash = (rotl(hash, 5) ^ w) * m;
     }
+
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return (hash_t)hash;
 }
 
 void StringValue::ctor(const char *p, size_t length)
@@ -76,115 +59,105 @@ void StringValue::ctor(const char *p, size_t length)
     memcpy(this->lstring, p, length * sizeof(char));
 }
 
+struct StringEntry
+{
+    hash_t hash;
+    StringValue *value;         // NULL if the slot is empty
+};
+
 void StringTable::_init(size_t size)
 {
-    table = (void **)mem.calloc(size, sizeof(void *));
-    tabledim = size;
+    tabledim = 16;
+    while (tabledim < size)
+        tabledim <<= 1;
+    table = (StringEntry *)mem.calloc(tabledim, sizeof(StringEntry));
     count = 0;
 }
 
 StringTable::~StringTable()
 {
     // Zero out dangling pointers to help garbage collector.
-    // Should zero out StringEntry's too.
-    for (size_t i = 0; i < count; i++)
-        table[i] = NULL;
+    // Should zero out StringValue's too.
+    memset(table, 0, tabledim * sizeof(StringEntry));
 
     mem.free(table);
     table = NULL;
 }
 
-struct StringEntry
-{
-    StringEntry *left;
-    StringEntry *right;
-    hash_t hash;
-
-    StringValue value;
-
-    static StringEntry *alloc(const char *s, size_t len);
-};
+/**********************************
+ * Find the slot for s, which is either the one holding it
+ * or the empty one where it would go.
+ */
 
-StringEntry *StringEntry::alloc(const char *s, size_t len)
+StringEntry *StringTable::search(const char *s, size_t len, hash_t hash)
 {
-    StringEntry *se;
-
-    se = (StringEntry *) mem.calloc(1,sizeof(StringEntry) + len + 1);
-    se->value.ctor(s, len);
-    se->hash = calcHash(s,len);
-    return se;
+    //printf("StringTable::search(%p,%d)\n",s,len);
+    size_t mask = tabledim - 1;
+    for (size_t u = hash & mask; 1; u = (u + 1) & mask)
+    {
+        StringEntry *se = &table[u];
+        if (!se->value ||
+            (se->hash == hash && se->value->len() == len &&
+             ::memcmp(s, se->value->toDchars(), len) == 0))
+            return se;
+    }
 }
 
-void **StringTable::search(const char *s, size_t len)
+/**********************************
+ * Double the size of the table.
+ */
+
+void StringTable::grow()
 {
-    hash_t hash;
-    unsigned u;
-    int cmp;
-    StringEntry **se;
+    StringEntry *oldtable = table;
+    size_t olddim = tabledim;
 
-    //printf("StringTable::search(%p,%d)\n",s,len);
-    hash = calcHash(s,len);
-    u = hash % tabledim;
-    se = (StringEntry **)&table[u];
-    //printf("\thash = %d, u = %d\n",hash,u);
-    while (*se)
+    tabledim *= 2;
+    table = (StringEntry *)mem.calloc(tabledim, sizeof(StringEntry));
+    size_t mask = tabledim - 1;
+    for (size_t i = 0; i < olddim; i++)
     {
-        cmp = (*se)->hash - hash;
-        if (cmp == 0)
-        {
-            cmp = (*se)->value.len() - len;
-            if (cmp == 0)
-            {
-                cmp = ::memcmp(s,(*se)->value.toDchars(),len);
-                if (cmp == 0)
-                    break;
-            }
-        }
-        if (cmp < 0)
-            se = &(*se)->left;
-        else
-            se = &(*se)->right;
+        StringEntry *se = &oldtable[i];
+        if (!se->value)
+            continue;
+        size_t u = se->hash & mask;
+        while (table[u].value)
+            u = (u + 1) & mask;
+        table[u] = *se;
     }
-    //printf("\treturn %p, %p\n",se, (*se));
-    return (void **)se;
+    mem.free(oldtable);
 }
 
 StringValue *StringTable::lookup(const char *s, size_t len)
-{   StringEntry *se;
-
-    se = *(StringEntry **)search(s,len);
-    if (se)
-        return &se->value;
-    else
-        return NULL;
+{
+    return search(s, len, calcHash(s, len))->value;
 }
 
 StringValue *StringTable::update(const char *s, size_t len)
-{   StringEntry **pse;
-    StringEntry *se;
-
-    pse = (StringEntry **)search(s,len);
-    se = *pse;
-    if (!se)                    // not in table: so create new entry
+{
+    hash_t hash = calcHash(s, len);
+    StringEntry *se = search(s, len, hash);
+    if (!se->value)             // not in table: so create new entry
     {
-        se = StringEntry::alloc(s, len);
-        *pse = se;
+        if (2 * (count + 1) > tabledim)
+        {
+            grow();
+            se = search(s, len, hash);
+        }
+        se->hash = hash;
+        se->value = (StringValue *)mem.malloc(sizeof(StringValue) + len + 1);
+        se->value->ptrvalue = NULL;
+        se->value->ctor(s, len);
+        count++;
     }
-    return &se->value;
+    return se->value;
 }
 
 StringValue *StringTable::insert(const char *s, size_t len)
-{   StringEntry **pse;
-    StringEntry *se;
-
-    pse = (StringEntry **)search(s,len);
-    se = *pse;
-    if (se)
+{
+    size_t oldcount = count;
+    StringValue *sv = update(s, len);
+    if (count == oldcount)
         return NULL;            // error: already in table
-    else
-    {
-        se = StringEntry::alloc(s, len);
-        *pse = se;
-    }
-    return &se->value;
+    return sv;
 }
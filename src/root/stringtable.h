@@ -16,7 +16,7 @@
 
 #include "root.h"
 
-struct StringEntry;
+hash_t calcHash(const char *str, size_t len);
 
 // StringValue is a variable-length structure as indicated by the last array
 // member with unspecified size.  It has neither proper c'tors nor a factory
@@ -38,18 +38,24 @@ public:
     const char *toDchars() const { return lstring; }
 
 private:
-    friend struct StringEntry;
+    friend struct StringTable;
     StringValue();  // not constructible
     // This is more like a placement new c'tor
     void ctor(const char *p, size_t length);
 };
 
+struct StringEntry;
+
+// Open addressing with linear probing. Each slot caches the full hash of its
+// string, so most mismatches are rejected without touching the string.
+// The table doubles when it gets half full; the StringValue's themselves
+// never move.
 struct StringTable
 {
 private:
-    void **table;
+    StringEntry *table;
     size_t count;
-    size_t tabledim;
+    size_t tabledim;            // always a power of 2
 
 public:
     void _init(size_t size = 37);
@@ -60,7 +66,8 @@ public:
     StringValue *update(const char *s, size_t len);
 
 private:
-    void **search(const char *s, size_t len);
+    StringEntry *search(const char *s, size_t len, hash_t hash);
+    void grow();
 };
 
 #endif
@@ -17,4 +17,20 @@ struct Thread
     static ThreadId getId();
 };
 
+/*******************
+ * Mutual exclusion lock, implemented in async.c alongside the
+ * other threading code.
+ */
+
+struct Mutex
+{
+    Mutex();
+    ~Mutex();
+    void lock();
+    void unlock();
+
+private:
+    void *handle;
+};
+
 #endif
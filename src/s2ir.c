@@ -53,7 +53,7 @@ Symbol *toSymbol(Type *t);
 unsigned totym(Type *tx);
 Symbol *toSymbol(Dsymbol *s);
 
-#define elem_setLoc(e,loc)      ((e)->Esrcpos.Sfilename = (char *)(loc).filename, \
+#define elem_setLoc(e,loc)      ((e)->Esrcpos.Sfilename = (char *)(loc).filename(), \
                                  (e)->Esrcpos.Slinnum = (loc).linnum, \
                                  (e)->Esrcpos.Scharnum = (loc).charnum)
 
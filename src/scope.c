@@ -35,6 +35,7 @@ Scope *Scope::freelist = NULL;
 
 void *Scope::operator new(size_t size)
 {
+    mem.keepRegions();          // semantic() is running
     if (freelist)
     {
         Scope *s = freelist;
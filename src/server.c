@@ -0,0 +1,876 @@
+
+/* Compiler implementation of the D programming language
+ * Copyright (c) 1999-2014 by Digital Mars
+ * All Rights Reserved
+ * written by Walter Bright
+ * http://www.digitalmars.com
+ * Distributed under the Boost Software License, Version 1.0.
+ * http://www.boost.org/LICENSE_1_0.txt
+ * https://github.com/D-Programming-Language/dmd/blob/master/src/server.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "rmem.h"
+#include "root.h"
+#include "stringtable.h"
+
+#include "mars.h"
+#include "module.h"
+#include "identifier.h"
+#include "lexer.h"
+#include "server.h"
+
+#if __linux__ || __APPLE__ || __FreeBSD__ || __OpenBSD__ || __sun
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+int tryMain(size_t argc, const char *argv[]);
+
+/* A module parsed by the server. It is not entered into any symbol
+ * table, so a child can take it over as if it had just parsed it.
+ */
+struct WarmModule
+{
+    Module *m;
+    const utf8_t *text;         // source text it was parsed from
+    size_t len;
+    int doDocComments;          // global.params.doDocComments it was parsed with
+    bool used;                  // taken over by this child
+};
+
+static StringTable warmModules;  // WarmModule's, by current directory + '\0' + file name
+
+/* The AST of a warm module can't be freed, not even when its file
+ * changes and it is parsed again, so a generation of the server (see
+ * serve()) only warms modules until it has allocated this much for them.
+ */
+static const size_t warmBudget = 512 * 1024 * 1024;
+static size_t warmSpent;        // allocated for warm modules by this generation
+
+// Server
+static bool server64;           // global.params.is64bit of the server
+static bool serverLP64;         // global.params.isLP64 of the server
+static int sigchldfd[2] = { -1, -1 };   // pipe SIGCHLD writes to, to wake up poll()
+
+// Child running a request
+static bool active;             // this is a child, and the warm modules can be used
+static int reportfd = -1;       // write end of pipe to the server
+static const char *childcwd;    // current directory of the request
+
+/*******************************************
+ * Read or write all of buf, or return false.
+ */
+
+static bool readAll(int fd, void *buf, size_t len)
+{
+    char *p = (char *)buf;
+    while (len)
+    {
+        ssize_t n = read(fd, p, len);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool writeAll(int fd, const void *buf, size_t len)
+{
+    const char *p = (const char *)buf;
+    while (len)
+    {
+        ssize_t n = write(fd, p, len);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool setSockName(struct sockaddr_un *addr, const char *sockname)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(sockname) >= sizeof(addr->sun_path))
+        return false;
+    strcpy(addr->sun_path, sockname);
+    return true;
+}
+
+/*******************************************
+ * Make a key for warmModules.
+ */
+
+static char *warmKey(const char *cwd, const char *srcname, size_t *plen)
+{
+    size_t cwdlen = strlen(cwd);
+    size_t srclen = strlen(srcname);
+    char *key = (char *)mem.malloc(cwdlen + 1 + srclen);
+    memcpy(key, cwd, cwdlen + 1);
+    memcpy(key + cwdlen + 1, srcname, srclen);
+    *plen = cwdlen + 1 + srclen;
+    return key;
+}
+
+static void freeWarm(WarmModule *w)
+{
+    mem.free((void *)w->text);
+    mem.free(w);
+}
+
+static bool contains(const utf8_t *p, size_t len, const char *s)
+{
+    size_t slen = strlen(s);
+    for (size_t i = 0; i + slen <= len; i++)
+    {
+        if (p[i] == s[0] && memcmp(p + i, s, slen) == 0)
+            return true;
+    }
+    return false;
+}
+
+/*******************************************
+ * Parse a module a child imported, unless it is warm already,
+ * and keep it if nothing in it depends on when or how it is parsed.
+ */
+
+static void warmModule(const char *cwd, int doDocComments,
+        const char *arg, const char *ident, const char *srcname)
+{
+    size_t keylen;
+    char *key = warmKey(cwd, srcname, &keylen);
+    StringValue *sv = warmModules.update(key, keylen);
+    mem.free(key);
+    WarmModule *w = (WarmModule *)sv->ptrvalue;
+
+    /* Time stamps can't tell a rewrite within their resolution, so
+     * it is the text that is compared.
+     */
+    File *f = new File(srcname);
+    if (f->read())
+    {
+        delete f;
+        return;
+    }
+    const utf8_t *buf = f->buffer;
+    size_t buflen = f->len;
+
+    if (w && w->len == buflen && memcmp(w->text, buf, buflen) == 0 &&
+        w->doDocComments == doDocComments)
+    {
+        delete f;
+        return;
+    }
+    if (w)
+    {
+        freeWarm(w);
+        sv->ptrvalue = NULL;
+    }
+
+    /* Leave out what Module::parseSource() would convert or complain
+     * about first, and what refers to the time of the compilation.
+     */
+    if ((buflen >= 2 && (buf[0] == 0 || buf[0] >= 0x80 || buf[1] == 0)) ||
+        (buflen >= 4 && memcmp(buf, "Ddoc", 4) == 0) ||
+        contains(buf, buflen, "__DATE__") ||
+        contains(buf, buflen, "__TIME__") ||
+        contains(buf, buflen, "__TIMESTAMP__"))
+    {
+        delete f;
+        return;
+    }
+
+    utf8_t *text = (utf8_t *)mem.malloc(buflen);
+    memcpy(text, buf, buflen);
+
+    Module *m = new Module(arg, Lexer::idPool(ident), 0, 0);
+    m->srcfile = f;
+
+    /* Keep only modules that parse without any diagnostics, as the
+     * children won't see them again. Deprecations are made errors
+     * so they get counted.
+     */
+    int saveDocComments = global.params.doDocComments;
+    char saveUseDeprecated = global.params.useDeprecated;
+    global.params.doDocComments = doDocComments;
+    global.params.useDeprecated = 0;
+    unsigned gaggedWarnings = global.gaggedWarnings;
+    unsigned errors = global.startGagging();
+
+    m->parseSource();
+
+    bool bad = global.endGagging(errors) || global.gaggedWarnings != gaggedWarnings;
+    global.params.doDocComments = saveDocComments;
+    global.params.useDeprecated = saveUseDeprecated;
+    if (bad)
+    {
+        mem.free(text);
+        delete f;
+        return;
+    }
+
+    w = (WarmModule *)mem.malloc(sizeof(WarmModule));
+    w->m = m;
+    w->text = text;
+    w->len = buflen;
+    w->doDocComments = doDocComments;
+    w->used = false;
+    sv->ptrvalue = (char *)w;
+}
+
+/*******************************************
+ * Receive a request: the client's stdin, stdout and stderr, and
+ * its current directory followed by its command line.
+ */
+
+static char *receive(int c, int fds[3], size_t *plen)
+{
+    unsigned len;
+    struct iovec iov;
+    iov.iov_base = &len;
+    iov.iov_len = sizeof(len);
+
+    union
+    {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(3 * sizeof(int))];
+    } control;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    ssize_t n = recvmsg(c, &msg, 0);
+    struct cmsghdr *cmsg = n == -1 ? NULL : CMSG_FIRSTHDR(&msg);
+    if (n != sizeof(len) || !cmsg ||
+        cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+        cmsg->cmsg_len != CMSG_LEN(3 * sizeof(int)))
+    {
+        // Don't keep whatever descriptors did come
+        for (; cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+                continue;
+            size_t nfds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            for (size_t i = 0; i < nfds; i++)
+            {
+                int fd;
+                memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+                close(fd);
+            }
+        }
+        return NULL;
+    }
+    memcpy(fds, CMSG_DATA(cmsg), 3 * sizeof(int));
+
+    if (len == 0 || len > 16 * 1024 * 1024)
+        goto Lerr;
+    {
+        char *p = (char *)mem.malloc(len + 1);
+        if (!readAll(c, p, len))
+        {
+            mem.free(p);
+            goto Lerr;
+        }
+        p[len] = 0;
+        *plen = len;
+        return p;
+    }
+
+Lerr:
+    for (int i = 0; i < 3; i++)
+        close(fds[i]);
+    return NULL;
+}
+
+/* A request being run by a child process.
+ */
+struct Request
+{
+    int c;                      // connection to the client, -1 if the slot is free
+    char *msg;                  // current directory, then the command line
+    pid_t pid;                  // child running it, -1 once it has exited
+    int status;                 // exit status to answer the client with
+    int pipefd;                 // the child reports its imports on it, -1 at end of file
+    OutBuffer imports;          // what has been read from pipefd
+};
+
+#define MAXREQUESTS 32
+
+static Request requests[MAXREQUESTS];
+static size_t nrequests;        // slots in use
+
+static void onSigchld(int sig)
+{
+    int saveerrno = errno;
+    char b = 0;
+    if (write(sigchldfd[1], &b, 1) == -1)
+        ;                       // full, and poll() will wake up anyway
+    errno = saveerrno;
+}
+
+/*******************************************
+ * Receive a request on c, and start a child process running it in r.
+ */
+
+static void startRequest(int s, int c, Request *r)
+{
+    int fds[3];
+    size_t len;
+    char *msg = receive(c, fds, &len);
+    if (!msg)
+    {
+        close(c);
+        return;
+    }
+
+    // Split into cwd and argv[]
+    const char *cwd = msg;
+    Strings args;
+    for (char *p = msg + strlen(msg) + 1; p < msg + len; p += strlen(p) + 1)
+        args.push(p);
+
+    int pfd[2];
+    if (pipe(pfd) == -1)
+    {
+        perror("pipe");
+        pfd[0] = pfd[1] = -1;
+    }
+
+    fflush(NULL);
+    pid_t pid = args.dim ? fork() : -1;
+    if (pid == 0)
+    {
+        signal(SIGCHLD, SIG_DFL);
+        close(sigchldfd[0]);
+        close(sigchldfd[1]);
+        close(s);
+        for (size_t i = 0; i < MAXREQUESTS; i++)
+        {
+            if (requests[i].c == -1)
+                continue;
+            close(requests[i].c);
+            if (requests[i].pipefd != -1)
+                close(requests[i].pipefd);
+        }
+        close(c);
+        if (pfd[0] != -1)
+            close(pfd[0]);
+        for (int i = 0; i < 3; i++)
+        {
+            dup2(fds[i], i);
+            close(fds[i]);
+        }
+        if (chdir(cwd) != 0)
+        {
+            perror(cwd);
+            _exit(EXIT_FAILURE);
+        }
+        active = true;
+        reportfd = pfd[1];
+        childcwd = cwd;
+        exit(tryMain(args.dim, (const char **)args.tdata()));
+    }
+    if (pfd[1] != -1)
+        close(pfd[1]);
+    for (int i = 0; i < 3; i++)
+        close(fds[i]);
+    if (pid == -1 && pfd[0] != -1)
+    {
+        close(pfd[0]);
+        pfd[0] = -1;
+    }
+
+    r->c = c;
+    r->msg = msg;
+    r->pid = pid;
+    r->status = EXIT_FAILURE;
+    r->pipefd = pfd[0];
+    r->imports.reset();
+    nrequests++;
+}
+
+/*******************************************
+ * Read what the child of r has to say about its imports.
+ */
+
+static void readImports(Request *r)
+{
+    char buf[4096];
+    ssize_t n = read(r->pipefd, buf, sizeof(buf));
+    if (n > 0)
+        r->imports.write(buf, n);
+    else if (n == 0 || errno != EINTR)
+    {
+        close(r->pipefd);
+        r->pipefd = -1;
+    }
+}
+
+/*******************************************
+ * Collect the exit status of every child that has exited.
+ */
+
+static void reapChildren()
+{
+    int wstatus;
+    pid_t pid;
+    while ((pid = waitpid(-1, &wstatus, WNOHANG)) > 0)
+    {
+        for (size_t i = 0; i < MAXREQUESTS; i++)
+        {
+            Request *r = &requests[i];
+            if (r->c == -1 || r->pid != pid)
+                continue;
+            if (WIFEXITED(wstatus))
+                r->status = WEXITSTATUS(wstatus);
+            else if (WIFSIGNALED(wstatus))
+                r->status = 128 + WTERMSIG(wstatus);   // as the shell would report it
+            r->pid = -1;
+            break;
+        }
+    }
+}
+
+/*******************************************
+ * Once the child of r is done, answer the client with its exit
+ * status. Then parse what the child imported, and free the slot.
+ */
+
+static void finishRequest(Request *r, int serverdir)
+{
+    writeAll(r->c, &r->status, sizeof(r->status));
+    close(r->c);
+    r->c = -1;
+    nrequests--;
+
+    // Records of: doDocComments, arg, ident, srcname
+    const char *cwd = r->msg;
+    if (r->imports.offset && warmSpent < warmBudget && chdir(cwd) == 0)
+    {
+        /* Parsing generates identifiers from global counters. Put them back
+         * so children number the root modules as an ordinary compile would.
+         */
+        size_t generateIdCount = Identifier::generateIdCount;
+        int uniqueIdCount = Lexer::uniqueIdCount;
+        size_t allocated = mem.allocated();
+
+        char *p = (char *)r->imports.data;
+        char *pend = p + r->imports.offset;
+        while (p < pend)
+        {
+            int doDocComments = *p++ == '1';
+            const char *arg = p;
+            p += strlen(p) + 1;
+            const char *ident = p;
+            p += strlen(p) + 1;
+            const char *srcname = p;
+            p += strlen(p) + 1;
+            warmModule(cwd, doDocComments, arg, ident, srcname);
+        }
+        warmSpent += mem.allocated() - allocated;
+        Identifier::generateIdCount = generateIdCount;
+        Lexer::uniqueIdCount = uniqueIdCount;
+        if (fchdir(serverdir) != 0)
+            perror("fchdir");
+    }
+    mem.free(r->msg);
+    r->msg = NULL;
+}
+
+/*******************************************
+ * Serve requests, each in a child process of its own, so a slow one
+ * doesn't hold up the rest. Stop taking new ones once warmBudget is
+ * spent, and return when the ones running are done.
+ * Returns:
+ *      true if a new generation should take over, false on error
+ */
+
+static bool serveGeneration(int s, int serverdir)
+{
+    if (pipe(sigchldfd) == -1)
+    {
+        perror("pipe");
+        return false;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        fcntl(sigchldfd[i], F_SETFL, O_NONBLOCK);
+        fcntl(sigchldfd[i], F_SETFD, FD_CLOEXEC);
+    }
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = &onSigchld;
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    sigaction(SIGCHLD, &sa, NULL);
+
+    for (size_t i = 0; i < MAXREQUESTS; i++)
+        requests[i].c = -1;
+
+    while (1)
+    {
+        bool accepting = warmSpent < warmBudget;
+        if (!accepting && !nrequests)
+            return true;
+
+        struct pollfd pfds[2 + MAXREQUESTS];
+        Request *preqs[2 + MAXREQUESTS];
+        nfds_t n = 0;
+        pfds[n].fd = sigchldfd[0];
+        pfds[n].events = POLLIN;
+        preqs[n++] = NULL;
+        if (accepting && nrequests < MAXREQUESTS)
+        {
+            pfds[n].fd = s;
+            pfds[n].events = POLLIN;
+            preqs[n++] = NULL;
+        }
+        for (size_t i = 0; i < MAXREQUESTS; i++)
+        {
+            Request *r = &requests[i];
+            if (r->c == -1 || r->pipefd == -1)
+                continue;
+            pfds[n].fd = r->pipefd;
+            pfds[n].events = POLLIN;
+            preqs[n++] = r;
+        }
+
+        if (poll(pfds, n, -1) == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("poll");
+            return false;
+        }
+
+        for (nfds_t i = 0; i < n; i++)
+        {
+            if (!pfds[i].revents)
+                continue;
+            if (preqs[i])
+                readImports(preqs[i]);
+            else if (pfds[i].fd == sigchldfd[0])
+            {
+                char buf[64];
+                while (read(sigchldfd[0], buf, sizeof(buf)) > 0)
+                    ;
+            }
+            else
+            {
+                int c = accept(s, NULL, NULL);
+                if (c == -1)
+                {
+                    if (errno == EINTR || errno == ECONNABORTED)
+                        continue;
+                    perror("accept");
+                    return false;
+                }
+                fcntl(c, F_SETFD, FD_CLOEXEC);
+                for (size_t j = 0; j < MAXREQUESTS; j++)
+                {
+                    if (requests[j].c == -1)
+                    {
+                        startRequest(s, c, &requests[j]);
+                        break;
+                    }
+                }
+            }
+        }
+
+        reapChildren();
+        for (size_t i = 0; i < MAXREQUESTS; i++)
+        {
+            Request *r = &requests[i];
+            if (r->c != -1 && r->pid == -1 && r->pipefd == -1)
+                finishRequest(r, serverdir);
+        }
+    }
+}
+
+/*******************************************
+ * Run as compile server, listening on Unix socket sockname.
+ * Does not return unless there is an error.
+ */
+
+int CompileServer::serve(const char *sockname)
+{
+    struct sockaddr_un addr;
+    if (!setSockName(&addr, sockname))
+    {
+        error(Loc(), "socket name %s is too long", sockname);
+        return EXIT_FAILURE;
+    }
+
+    // Remove the socket of a server that has gone away
+    struct stat st;
+    if (lstat(sockname, &st) == 0)
+    {
+        if (!S_ISSOCK(st.st_mode))
+        {
+            error(Loc(), "%s exists and is not a socket", sockname);
+            return EXIT_FAILURE;
+        }
+        unlink(sockname);
+    }
+
+    int s = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s == -1)
+    {
+        perror("socket");
+        return EXIT_FAILURE;
+    }
+    mode_t mask = umask(077);   // only for this user
+    int rc = bind(s, (struct sockaddr *)&addr, sizeof(addr));
+    umask(mask);
+    if (rc == -1 || listen(s, 16) == -1)
+    {
+        perror(sockname);
+        close(s);
+        return EXIT_FAILURE;
+    }
+    fcntl(s, F_SETFD, FD_CLOEXEC);
+    signal(SIGPIPE, SIG_IGN);
+
+    int serverdir = open(".", O_RDONLY);
+    if (serverdir != -1)
+        fcntl(serverdir, F_SETFD, FD_CLOEXEC);
+    warmModules._init();
+    server64 = global.params.is64bit;
+    serverLP64 = global.params.isLP64;
+
+    if (global.params.verbose)
+        fprintf(global.stdmsg, "server    %s\n", sockname);
+
+    /* The warm modules are kept by a generation process forked from
+     * this one, which parses nothing itself. When a generation has
+     * spent warmBudget, the next one starts afresh from here, and the
+     * memory is given back. Clients wait on the socket meanwhile.
+     */
+    while (1)
+    {
+        fflush(NULL);
+        pid_t pid = fork();
+        if (pid == -1)
+        {
+            perror("fork");
+            break;
+        }
+        if (pid == 0)
+        {
+            bool renew = serveGeneration(s, serverdir);
+            fflush(NULL);
+            _exit(renew ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        int wstatus;
+        while (waitpid(pid, &wstatus, 0) == -1 && errno == EINTR)
+            ;
+        if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != EXIT_SUCCESS)
+            break;
+    }
+    close(s);
+    return EXIT_FAILURE;
+}
+
+/*******************************************
+ * Send the command line to the compile server at sockname, and wait
+ * for it to be run with our stdin, stdout and stderr.
+ * Returns:
+ *      its exit status, or -1 if there is no server
+ */
+
+int CompileServer::request(const char *sockname, size_t argc, const char **argv)
+{
+    struct sockaddr_un addr;
+    if (!setSockName(&addr, sockname))
+        return -1;
+    int s = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s == -1)
+        return -1;
+    if (connect(s, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+    {
+        close(s);
+        return -1;
+    }
+
+    OutBuffer buf;
+    char *cwd = getcwd(NULL, 0);
+    if (!cwd)
+    {
+        close(s);
+        return -1;
+    }
+    buf.writestring(cwd);
+    buf.writeByte(0);
+    ::free(cwd);
+    for (size_t i = 0; i < argc; i++)
+    {
+        buf.writestring(argv[i]);
+        buf.writeByte(0);
+    }
+
+    unsigned len = (unsigned)buf.offset;
+    struct iovec iov;
+    iov.iov_base = &len;
+    iov.iov_len = sizeof(len);
+
+    union
+    {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(3 * sizeof(int))];
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(3 * sizeof(int));
+    int fds[3] = { 0, 1, 2 };
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    fflush(NULL);
+    int status;
+    if (sendmsg(s, &msg, 0) != sizeof(len) ||
+        !writeAll(s, buf.data, buf.offset) ||
+        !readAll(s, &status, sizeof(status)))
+    {
+        error(Loc(), "lost connection to compile server %s", sockname);
+        status = EXIT_FAILURE;
+    }
+    close(s);
+    return status;
+}
+
+/*******************************************
+ * In a child running a request: the warm modules refer to the
+ * server's identifiers and basic types, so those must not be set up
+ * again. That's only possible if the server has the same target.
+ */
+
+bool CompileServer::keepTypes()
+{
+    if (active &&
+        (global.params.is64bit != server64 || global.params.isLP64 != serverLP64))
+        active = false;
+    return active;
+}
+
+/*******************************************
+ * In a child running a request: if the server has parsed the source
+ * of m, which Module::load() has just created, return that instead.
+ * It still needs to be enter()'d.
+ */
+
+Module *CompileServer::lookup(Module *m)
+{
+    if (!active)
+        return NULL;
+
+    const char *srcname = m->srcfile->toChars();
+    size_t keylen;
+    char *key = warmKey(childcwd, srcname, &keylen);
+    StringValue *sv = warmModules.lookup(key, keylen);
+    mem.free(key);
+    WarmModule *w = sv ? (WarmModule *)sv->ptrvalue : NULL;
+    if (!w || w->used ||
+        w->doDocComments != global.params.doDocComments ||
+        w->m->ident != m->ident ||
+        strcmp(w->m->arg, m->arg) != 0)
+        return NULL;
+
+    // Only the text tells for sure that it is unchanged
+    File f(srcname);
+    if (f.read())
+        return NULL;
+    bool same = f.len == w->len && memcmp(f.buffer, w->text, w->len) == 0;
+    if (!same)
+        return NULL;
+
+    w->used = true;
+    Module *mw = w->m;
+    mw->objfile = m->objfile;   // output names are per request
+    mw->symfile = m->symfile;
+    return mw;
+}
+
+/*******************************************
+ * In a child running a request: tell the server that m, which was
+ * not warm, has been loaded by Module::load() as ident.
+ */
+
+void CompileServer::loaded(Module *m, Identifier *ident)
+{
+    if (reportfd == -1 || m->isDocFile)
+        return;
+
+    OutBuffer buf;
+    buf.writeByte(global.params.doDocComments ? '1' : '0');
+    buf.writestring(m->arg);
+    buf.writeByte(0);
+    buf.writestring(ident->toChars());
+    buf.writeByte(0);
+    buf.writestring(m->srcfile->toChars());
+    buf.writeByte(0);
+    if (!writeAll(reportfd, buf.data, buf.offset))
+    {
+        close(reportfd);
+        reportfd = -1;
+    }
+}
+
+#else
+
+int CompileServer::serve(const char *sockname)
+{
+    error(Loc(), "-server is not supported on this platform");
+    return EXIT_FAILURE;
+}
+
+int CompileServer::request(const char *sockname, size_t argc, const char **argv)
+{
+    return -1;
+}
+
+bool CompileServer::keepTypes()
+{
+    return false;
+}
+
+Module *CompileServer::lookup(Module *m)
+{
+    return NULL;
+}
+
+void CompileServer::loaded(Module *m, Identifier *ident)
+{
+}
+
+#endif
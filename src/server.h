@@ -0,0 +1,38 @@
+
+/* Compiler implementation of the D programming language
+ * Copyright (c) 1999-2014 by Digital Mars
+ * All Rights Reserved
+ * written by Walter Bright
+ * http://www.digitalmars.com
+ * Distributed under the Boost Software License, Version 1.0.
+ * http://www.boost.org/LICENSE_1_0.txt
+ * https://github.com/D-Programming-Language/dmd/blob/master/src/server.h
+ */
+
+#ifndef DMD_SERVER_H
+#define DMD_SERVER_H
+
+#ifdef __DMC__
+#pragma once
+#endif /* __DMC__ */
+
+class Module;
+class Identifier;
+
+/* A compile server (-server=socket) runs each command line sent to it
+ * by a client (-client=socket) in a child process forked from itself.
+ * Between requests the server parses the modules the children
+ * imported, so that later children find them already parsed.
+ */
+
+struct CompileServer
+{
+    static int serve(const char *sockname);
+    static int request(const char *sockname, size_t argc, const char **argv);
+
+    static bool keepTypes();
+    static Module *lookup(Module *m);
+    static void loaded(Module *m, Identifier *ident);
+};
+
+#endif /* DMD_SERVER_H */
@@ -31,6 +31,7 @@
 #include "template.h"
 #include "attrib.h"
 #include "import.h"
+#include "memstats.h"
 
 bool walkPostorder(Statement *s, StoppableVisitor *v);
 bool isNonAssignmentArrayOp(Expression *e);
@@ -66,9 +67,15 @@ LabelStatement *checkLabeledLoop(Scope *sc, Statement *statement)
 
 /******************************** Statement ***************************/
 
+void *Statement::operator new(size_t size)
+{
+    return MemStats::allocate(size, NODEstatement);
+}
+
 Statement::Statement(Loc loc)
     : loc(loc)
 {
+    mem.keepRegions();
     // If this is an in{} contract scope statement (skip for determining
     //  inlineStatus of a function body for header content)
 }
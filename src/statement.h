@@ -89,6 +89,7 @@ class Statement : public RootObject
 public:
     Loc loc;
 
+    static void *operator new(size_t size);
     Statement(Loc loc);
     virtual Statement *syntaxCopy();
 
@@ -27,6 +27,7 @@
 #include "module.h"
 #include "aggregate.h"
 #include "declaration.h"
+#include "enum.h"
 #include "dsymbol.h"
 #include "mars.h"
 #include "dsymbol.h"
@@ -34,6 +35,7 @@
 #include "hdrgen.h"
 #include "id.h"
 #include "attrib.h"
+#include "timetrace.h"
 
 #define LOG     0
 
@@ -364,40 +366,111 @@ int arrayObjectMatch(Objects *oa1, Objects *oa2)
 }
 
 
+/************************************
+ * Mix v into hash h, so that the result depends on the order
+ * and on all the bits of each v.
+ */
+static inline hash_t mixHash(hash_t h, hash_t v)
+{
+    h = (h ^ v) * 0x9E3779B97F4A7C15ULL;
+    return h ^ (h >> 29);
+}
+
+static hash_t expressionsHash(Expressions *exps);
+
+/************************************
+ * Return hash of the value of a template argument.
+ * Must follow the logic of the equals() of each Expression.
+ */
+static hash_t expressionHash(Expression *e)
+{
+    hash_t hash = e->op;
+    switch (e->op)
+    {
+        case TOKint64:
+            return mixHash(hash, (hash_t)((IntegerExp *)e)->getInteger());
+
+        case TOKstring:
+        {
+            /* StringExp::compare() compares len code units of the
+             * size of either one, so only the first len bytes are sure
+             * to be the same.
+             */
+            StringExp *se = (StringExp *)e;
+            return mixHash(hash, calcHash((const char *)se->string, se->len));
+        }
+
+        case TOKarrayliteral:
+            return mixHash(hash, expressionsHash(((ArrayLiteralExp *)e)->elements));
+
+        case TOKassocarrayliteral:
+            // keys can be in any order
+            return mixHash(hash, ((AssocArrayLiteralExp *)e)->keys->dim);
+
+        case TOKstructliteral:
+        {
+            StructLiteralExp *se = (StructLiteralExp *)e;
+            return mixHash(mixHash(hash, (hash_t)se->sd), expressionsHash(se->elements));
+        }
+
+        case TOKvar:
+            return mixHash(hash, (hash_t)((VarExp *)e)->var);
+
+        case TOKtuple:
+            return mixHash(hash, expressionsHash(((TupleExp *)e)->exps));
+
+        default:
+            // Reals compare equal when their bits differ, as 0 and -0 do
+            return hash;
+    }
+}
+
+static hash_t expressionsHash(Expressions *exps)
+{
+    hash_t hash = exps->dim;
+    for (size_t i = 0; i < exps->dim; i++)
+    {
+        Expression *e = (*exps)[i];
+        hash = mixHash(hash, e ? expressionHash(e) : 0);
+    }
+    return hash;
+}
+
 /************************************
  * Return hash of Objects.
  */
 hash_t arrayObjectHash(Objects *oa1)
 {
-    hash_t hash = 0;
+    hash_t hash = oa1->dim;
     for (size_t j = 0; j < oa1->dim; j++)
     {
         /* Must follow the logic of match()
          */
         RootObject *o1 = (*oa1)[j];
         if (Type *t1 = isType(o1))
-            hash += (size_t)t1->deco;
+            hash = mixHash(hash, (hash_t)t1->deco);    // deco strings are unique
         else
         {
             Dsymbol *s1 = isDsymbol(o1);
             Expression *e1 = s1 ? getValue(s1) : getValue(isExpression(o1));
             if (e1)
-            {
-                if (e1->op == TOKint64)
-                {
-                    IntegerExp *ne = (IntegerExp *)e1;
-                    hash += (size_t)ne->getInteger();
-                }
-            }
+                hash = mixHash(hash, expressionHash(e1));
             else if (s1)
             {
                 FuncAliasDeclaration *fa1 = s1->isFuncAliasDeclaration();
                 if (fa1)
                     s1 = fa1->toAliasFunc();
-                hash += (size_t)(void *)s1->getIdent() + (size_t)(void *)s1->parent;
+                /* match() allows functions with different parents, but
+                 * instances of them were never looked up as the same
+                 * one, so keep it that way.
+                 */
+                hash = mixHash(hash, (hash_t)(void *)s1->getIdent());
+                hash = mixHash(hash, (hash_t)(void *)s1->parent);
             }
             else if (Tuple *u1 = isTuple(o1))
-                hash += arrayObjectHash(&u1->objects);
+                hash = mixHash(hash, arrayObjectHash(&u1->objects));
+            else
+                hash = mixHash(hash, 0);
         }
     }
     return hash;
@@ -512,6 +585,8 @@ TemplateDeclaration::TemplateDeclaration(Loc loc, Identifier *id,
     this->isstatic = true;
     this->previous = NULL;
     this->protection = PROTundefined;
+    this->instances = NULL;
+    this->instancesdim = 0;
     this->numinstances = 0;
 
     // Compute in advance for Ddoc's use
@@ -783,18 +858,24 @@ bool TemplateDeclaration::evaluateConstraint(
             for (Scope *scx = sc; scx; scx = scx->enclosing)
             {
                 if (scx == p->sc)
+                {
+                    numrejected++;
                     return false;
+                }
             }
         }
         /* BUG: should also check for ref param differences
          */
     }
 
+    numconstraints++;
+
     TemplatePrevious pr;
     pr.prev    = previous;
     pr.sc      = paramscope;
     pr.dedargs = dedargs;
     previous = &pr;                 // add this to threaded list
+    numprevious++;
 
     unsigned int nerrors = global.errors;
 
@@ -863,6 +944,7 @@ bool TemplateDeclaration::evaluateConstraint(
 
     scx = scx->pop();
     previous = pr.prev;             // unlink from threaded list
+    numprevious--;
 
     if (nerrors != global.errors)   // if any errors from evaluating the constraint, no match
         return false;
@@ -1144,6 +1226,204 @@ MATCH TemplateDeclaration::leastAsSpecialized(Scope *sc, TemplateDeclaration *td
 }
 
 
+/*************************************************
+ * deduceFunctionTemplateMatch() is called for the same template with
+ * the same arguments from one call site after another. When its result
+ * depends only on the template, the explicit template arguments, the
+ * type of 'this', and the types of the function arguments and which of
+ * them are lvalues (for auto ref), it is kept in a hash table keyed on
+ * those.
+ */
+
+struct DeductionArg
+{
+    Type *type;
+    bool isLvalue;
+};
+
+struct Deduction
+{
+    hash_t hash;
+    TemplateDeclaration *td;
+    FuncDeclaration *f;         // the function declaration matched against
+    Objects *tiargs;            // copy of the explicit template arguments
+    Type *tthis;
+    size_t nargs;
+    DeductionArg *args;
+
+    MATCH match;
+    FuncDeclaration *fd;        // the partial instantiation
+    Objects *dedargs;           // copy of ti->tiargs if it was set, or NULL
+    Objects *tdtypes;           // copy of ti->tdtypes
+    bool constraints;           // constraints were evaluated to get it
+};
+
+static Deduction **deductions;  // open addressed, at most half full
+static size_t deductionsdim;    // power of 2
+static size_t numdeductions;
+
+unsigned TemplateDeclaration::numprevious;
+unsigned TemplateDeclaration::numrejected;
+unsigned TemplateDeclaration::numconstraints;
+size_t TemplateDeclaration::deductionLookups;
+size_t TemplateDeclaration::deductionHits;
+
+/* Function arguments whose matching depends only on their type
+ * and whether they are lvalues: variables that optimize() can't
+ * replace with their value.
+ */
+static bool isPlainArg(Expression *e)
+{
+    if (e->op != TOKvar || !e->type->deco)
+        return false;
+    VarDeclaration *v = ((VarExp *)e)->var->isVarDeclaration();
+    return v && !(v->storage_class & (STCmanifest | STCconst | STCimmutable | STClazy)) &&
+           v->type->isMutable();
+}
+
+/* Neither t nor the types it is made of refer to an aggregate or enum
+ * that is still in semantic(), whose members constraints and matches
+ * could see change.
+ */
+static bool deductionStable(Type *t)
+{
+    if (!t->deco)
+        return false;
+    switch (t->ty)
+    {
+        case Tpointer:
+        case Tarray:
+        case Tsarray:
+        case Tdelegate:
+            return deductionStable(t->nextOf());
+
+        case Taarray:
+            return deductionStable(((TypeAArray *)t)->index) && deductionStable(t->nextOf());
+
+        case Tfunction:
+        {
+            TypeFunction *tf = (TypeFunction *)t;
+            if (tf->next && !deductionStable(tf->next))
+                return false;
+            size_t dim = Parameter::dim(tf->parameters);
+            for (size_t i = 0; i < dim; i++)
+            {
+                if (!deductionStable(Parameter::getNth(tf->parameters, i)->type))
+                    return false;
+            }
+            return true;
+        }
+
+        case Tstruct:
+            return ((TypeStruct *)t)->sym->semanticRun >= PASSsemanticdone;
+
+        case Tclass:
+            return ((TypeClass *)t)->sym->semanticRun >= PASSsemanticdone;
+
+        case Tenum:
+        {
+            EnumDeclaration *ed = ((TypeEnum *)t)->sym;
+            return ed->semanticRun >= PASSsemanticdone && ed->memtype &&
+                   deductionStable(ed->memtype);
+        }
+
+        default:
+            return true;
+    }
+}
+
+/* Compute the hash of a deduction into *phash.
+ * Returns false if the deduction can't be kept.
+ */
+static bool deductionHash(TemplateDeclaration *td, FuncDeclaration *f, Objects *tiargs,
+        Type *tthis, Expressions *fargs, hash_t *phash)
+{
+    if (tthis && !deductionStable(tthis))
+        return false;
+
+    hash_t hash = mixHash((hash_t)(void *)td, (hash_t)(void *)f);
+    if (tiargs)
+    {
+        for (size_t i = 0; i < tiargs->dim; i++)
+        {
+            RootObject *o = (*tiargs)[i];
+            Type *t = isType(o);
+            if (t ? !deductionStable(t) : isTuple(o) != NULL)
+                return false;
+        }
+        hash = mixHash(hash, arrayObjectHash(tiargs));
+    }
+    hash = mixHash(hash, (hash_t)(void *)tthis);
+    size_t nargs = fargs ? fargs->dim : 0;
+    for (size_t i = 0; i < nargs; i++)
+    {
+        Expression *e = (*fargs)[i];
+        if (!isPlainArg(e) || !deductionStable(e->type))
+            return false;
+        hash = mixHash(hash, (hash_t)(void *)e->type * 2 + e->isLvalue());
+    }
+    *phash = hash;
+    return true;
+}
+
+static Deduction *findDeduction(hash_t hash, TemplateDeclaration *td, FuncDeclaration *f,
+        Objects *tiargs, Type *tthis, Expressions *fargs)
+{
+    if (!numdeductions)
+        return NULL;
+    size_t nargs = fargs ? fargs->dim : 0;
+    size_t mask = deductionsdim - 1;
+    for (size_t i = hash & mask; deductions[i]; i = (i + 1) & mask)
+    {
+        Deduction *d = deductions[i];
+        if (d->hash != hash || d->td != td || d->f != f || d->tthis != tthis || d->nargs != nargs)
+            continue;
+        if (!d->tiargs != !tiargs || tiargs && !arrayObjectMatch(d->tiargs, tiargs))
+            continue;
+        size_t j;
+        for (j = 0; j < nargs; j++)
+        {
+            Expression *e = (*fargs)[j];
+            if (d->args[j].type != e->type || d->args[j].isLvalue != e->isLvalue())
+                break;
+        }
+        if (j == nargs)
+            return d;
+    }
+    return NULL;
+}
+
+static void addDeduction(Deduction *d)
+{
+    if ((numdeductions + 1) * 2 > deductionsdim)
+    {
+        size_t newdim = deductionsdim ? deductionsdim * 2 : 64;
+        Deduction **newp = (Deduction **)mem.calloc(newdim, sizeof(Deduction *));
+        size_t mask = newdim - 1;
+        for (size_t j = 0; j < deductionsdim; j++)
+        {
+            Deduction *d1 = deductions[j];
+            if (d1)
+            {
+                size_t i = d1->hash & mask;
+                while (newp[i])
+                    i = (i + 1) & mask;
+                newp[i] = d1;
+            }
+        }
+        mem.free(deductions);
+        deductions = newp;
+        deductionsdim = newdim;
+    }
+
+    size_t mask = deductionsdim - 1;
+    size_t i = d->hash & mask;
+    while (deductions[i])
+        i = (i + 1) & mask;
+    deductions[i] = d;
+    numdeductions++;
+}
+
 /*************************************************
  * Match function arguments against a specific template function.
  * Input:
@@ -1176,11 +1456,20 @@ MATCH TemplateDeclaration::deduceFunctionTemplateMatch(
     int fvarargs;                       // function varargs
     unsigned wildmatch = 0;
     size_t inferStart = 0;
+    MATCH result;
 
     Loc loc = ti->loc;
     Objects *tiargs = ti->tiargs;
     Objects *dedargs = new Objects();
     Objects* dedtypes = &ti->tdtypes;   // for T:T*, the dedargs is the T*, dedtypes is the T
+    FuncDeclaration *f = fd;
+    Type *tthis0 = tthis;
+    hash_t hash = 0;
+    bool cacheable;
+    unsigned olderrors = global.errors;
+    unsigned oldmessages = global.warnings + global.gaggedWarnings + global.deprecations;
+    unsigned oldrejected = numrejected;
+    unsigned oldconstraints = numconstraints;
 
 #if 0
     printf("\nTemplateDeclaration::deduceFunctionTemplateMatch() %s\n", toChars());
@@ -1206,6 +1495,25 @@ MATCH TemplateDeclaration::deduceFunctionTemplateMatch(
     if (errors || fd->errors)
         return MATCHnomatch;
 
+    deductionLookups++;
+    cacheable = deductionHash(this, fd, tiargs, tthis, fargs, &hash);
+    if (cacheable)
+    {
+        Deduction *d = findDeduction(hash, this, fd, tiargs, tthis, fargs);
+        /* A deduction that evaluated constraints might have been rejected
+         * as recursive by the attempts now on the stack.
+         */
+        if (d && (!numprevious || !d->constraints))
+        {
+            deductionHits++;
+            fd = d->fd;
+            if (d->dedargs)
+                ti->tiargs = d->dedargs->copy();
+            memcpy(dedtypes->tdata(), d->tdtypes->tdata(), dedtypes->dim * sizeof(*dedtypes->tdata()));
+            return d->match;
+        }
+    }
+
     // Set up scope for parameters
     ScopeDsymbol *paramsym = new ScopeDsymbol();
     paramsym->parent = scope->parent;   // should use hasnestedArgs and enclosing?
@@ -1641,6 +1949,7 @@ Lretry:
                         /* If a semantic error occurs while doing alias this,
                          * eg purity(bug 7295), just regard it as not a match.
                          */
+                        cacheable = false;      // resolved in sc
                         unsigned olderrors = global.startGagging();
                         Expression *e = resolveAliasThis(sc, farg);
                         if (!global.endGagging(olderrors))
@@ -1699,6 +2008,7 @@ Lretry:
             case Tsarray:
             case Taarray:
             {
+                cacheable = false;      // resolved in sc
                 // Perhaps we can do better with this, see TypeFunction::callMatch()
                 if (tb->ty == Tsarray)
                 {
@@ -1855,6 +2165,7 @@ Lmatch:
             }
             else
             {
+                cacheable = false;      // may depend on loc, as __LINE__ does
                 oded = tparam->defaultArg(loc, paramscope);
                 if (!oded)
                 {
@@ -1912,12 +2223,43 @@ Lmatch:
 
     paramscope->pop();
     //printf("\tmatch %d\n", match);
-    return (MATCH)(match | (matchTiargs<<4));
+    result = (MATCH)(match | (matchTiargs<<4));
+    goto Lret;
 
 Lnomatch:
     paramscope->pop();
     //printf("\tnomatch\n");
-    return MATCHnomatch;
+    result = MATCHnomatch;
+
+Lret:
+    if (cacheable &&
+        global.errors == olderrors &&
+        global.warnings + global.gaggedWarnings + global.deprecations == oldmessages &&
+        numrejected == oldrejected)
+    {
+        size_t nargs = fargs ? fargs->dim : 0;
+        Deduction *d = (Deduction *)mem.malloc(sizeof(Deduction) + nargs * sizeof(DeductionArg));
+        d->hash = hash;
+        d->td = this;
+        d->f = f;
+        d->tiargs = tiargs ? tiargs->copy() : NULL;
+        d->tthis = tthis0;
+        d->nargs = nargs;
+        d->args = (DeductionArg *)(d + 1);
+        for (size_t i = 0; i < nargs; i++)
+        {
+            Expression *e = (*fargs)[i];
+            d->args[i].type = e->type;
+            d->args[i].isLvalue = e->isLvalue();
+        }
+        d->match = result;
+        d->fd = fd;
+        d->dedargs = ti->tiargs != tiargs ? ti->tiargs->copy() : NULL;
+        d->tdtypes = dedtypes->copy();
+        d->constraints = numconstraints != oldconstraints;
+        addDeduction(d);
+    }
+    return result;
 }
 
 /**************************************************
@@ -2278,10 +2620,12 @@ void functionResolve(Match *m, Dsymbol *dstart, Loc loc, Scope *sc,
                 pr.sc = sc;
                 pr.dedargs = &dedtypesX;
                 tdx->previous = &pr;                 // add this to threaded list
+                TemplateDeclaration::numprevious++;
 
                 fd = resolveFuncCall(loc, sc, s, NULL, tthis, fargs, 1);
 
                 tdx->previous = pr.prev;             // unlink from threaded list
+                TemplateDeclaration::numprevious--;
             }
             else if (s->isFuncDeclaration())
             {
@@ -2829,6 +3173,9 @@ PROT TemplateDeclaration::prot()
     return protection;
 }
 
+size_t TemplateDeclaration::instanceLookups;
+size_t TemplateDeclaration::instanceProbes;
+
 /****************************************************
  * Given a new instance tithis of this TemplateDeclaration,
  * see if there already exists an instance.
@@ -2840,27 +3187,24 @@ TemplateInstance *TemplateDeclaration::findExistingInstance(TemplateInstance *ti
     tithis->fargs = fargs;
     hash_t hash = tithis->hashCode();
 
-    if (!buckets.dim)
-    {
-        buckets.setDim(7);
-        buckets.zero();
-    }
-    size_t bi = hash % buckets.dim;
-    TemplateInstances *instances = buckets[bi];
-    if (instances)
+    instanceLookups++;
+    if (!numinstances)
+        return NULL;
+    size_t mask = instancesdim - 1;
+    for (size_t i = hash & mask; ; i = (i + 1) & mask)
     {
-        for (size_t i = 0; i < instances->dim; i++)
-        {
-            TemplateInstance *ti = (*instances)[i];
+        instanceProbes++;
+        TemplateInstance *ti = instances[i];
+        if (!ti)
+            break;
 #if LOG
-            printf("\t%s: checking for match with instance %d (%p): '%s'\n", tithis->toChars(), i, ti, ti->toChars());
+        printf("\t%s: checking for match with instance %d (%p): '%s'\n", tithis->toChars(), i, ti, ti->toChars());
 #endif
-            if (hash == ti->hash &&
-                tithis->compare(ti) == 0)
-            {
-                //printf("hash = %p yes %d n = %d\n", hash, instances->dim, numinstances);
-                return ti;
-            }
+        if (hash == ti->hash &&
+            tithis->compare(ti) == 0)
+        {
+            //printf("hash = %p yes n = %d\n", hash, numinstances);
+            return ti;
         }
     }
     //printf("hash = %p no\n", hash);
@@ -2874,43 +3218,44 @@ TemplateInstance *TemplateDeclaration::findExistingInstance(TemplateInstance *ti
 
 TemplateInstance *TemplateDeclaration::addInstance(TemplateInstance *ti)
 {
-    /* See if we need to rehash
+    /* See if we need to rehash, keeping the table at most half full
      */
-    if (numinstances > buckets.dim * 4)
+    if ((numinstances + 1) * 2 > instancesdim)
     {
-        // rehash
         //printf("rehash\n");
-        size_t newdim = buckets.dim * 2 + 1;
-        TemplateInstances **newp = (TemplateInstances **)::calloc(newdim, sizeof(TemplateInstances *));
-        assert(newp);
-        for (size_t bi = 0; bi < buckets.dim; ++bi)
+        size_t newdim = instancesdim ? instancesdim * 2 : 8;
+        TemplateInstance **newp = (TemplateInstance **)mem.calloc(newdim, sizeof(TemplateInstance *));
+        size_t mask = newdim - 1;
+
+        /* Start after an empty slot, so the instances with the same hash
+         * stay in the order they were added, and the first one added is
+         * the one findExistingInstance() finds.
+         */
+        size_t start = 0;
+        while (start < instancesdim && instances[start])
+            start++;
+        for (size_t j = 0; j < instancesdim; j++)
         {
-            TemplateInstances *instances = buckets[bi];
-            if (instances)
+            TemplateInstance *ti1 = instances[(start + j) & (instancesdim - 1)];
+            if (ti1)
             {
-                for (size_t i = 0; i < instances->dim; i++)
-                {
-                    TemplateInstance *ti1 = (*instances)[i];
-                    size_t newbi = ti1->hash % newdim;
-                    TemplateInstances *newinstances = newp[newbi];
-                    if (!newinstances)
-                        newp[newbi] = newinstances = new TemplateInstances();
-                    newinstances->push(ti1);
-                }
-                delete instances;
+                size_t i = ti1->hash & mask;
+                while (newp[i])
+                    i = (i + 1) & mask;
+                newp[i] = ti1;
             }
         }
-        buckets.setDim(newdim);
-        memcpy(buckets.tdata(), newp, newdim * sizeof(TemplateInstance *));
-        ::free(newp);
+        mem.free(instances);
+        instances = newp;
+        instancesdim = newdim;
     }
 
     // Insert ti into hash table
-    size_t bi = ti->hash % buckets.dim;
-    TemplateInstances *instances = buckets[bi];
-    if (!instances)
-        buckets[bi] = instances = new TemplateInstances();
-    instances->push(ti);
+    size_t mask = instancesdim - 1;
+    size_t i = ti->hash & mask;
+    while (instances[i])
+        i = (i + 1) & mask;
+    instances[i] = ti;
     ++numinstances;
     return ti;
 }
@@ -2923,18 +3268,41 @@ TemplateInstance *TemplateDeclaration::addInstance(TemplateInstance *ti)
 
 void TemplateDeclaration::removeInstance(TemplateInstance *handle)
 {
-    size_t bi = handle->hash % buckets.dim;
-    TemplateInstances *instances = buckets[bi];
-    for (size_t i = 0; i < instances->dim; i++)
+    size_t mask = instancesdim - 1;
+    size_t i = handle->hash & mask;
+    while (instances[i] != handle)
     {
-        TemplateInstance *ti = (*instances)[i];
-        if (handle == ti)
+        if (!instances[i])
+            return;
+        i = (i + 1) & mask;
+    }
+
+    /* Move back the instances after it that would no longer be
+     * found past the hole, so the table needs no deleted markers.
+     */
+    size_t j = i;
+    while (1)
+    {
+        instances[i] = NULL;
+        TemplateInstance *ti;
+        while (1)
         {
-            instances->remove(i);
+            j = (j + 1) & mask;
+            ti = instances[j];
+            if (!ti)
+            {
+                --numinstances;
+                return;
+            }
+            size_t k = ti->hash & mask;     // where ti wants to be
+            // Leave ti if k is cyclically in (i, j]
+            if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+                continue;
             break;
         }
+        instances[i] = ti;
+        i = j;
     }
-    --numinstances;
 }
 
 /*******************************************
@@ -6009,6 +6377,7 @@ void TemplateInstance::semantic(Scope *sc, Expressions *fargs)
 #endif
         return;
     }
+    TimeTraceScope tt("template", "instantiate", this);
 
     // get the enclosing template instance from the scope tinst
     tinst = sc->tinst;
@@ -6351,7 +6720,7 @@ void TemplateInstance::semantic(Scope *sc, Expressions *fargs)
             }
         }
     }
-    if (found_deferred_ad || Module::deferred.dim)
+    if (found_deferred_ad || Module::numDeferred())
         goto Laftersemantic;
     }
 
@@ -7923,8 +8292,9 @@ hash_t TemplateInstance::hashCode()
 {
     if (!hash)
     {
-        hash = (size_t)(void *)enclosing;
-        hash += arrayObjectHash(&tdtypes);
+        hash = mixHash((size_t)(void *)enclosing, arrayObjectHash(&tdtypes));
+        if (!hash)
+            hash = 1;           // 0 means not computed yet
     }
     return hash;
 }
@@ -8236,7 +8606,7 @@ void TemplateMixin::semantic(Scope *sc)
     printf("\tdo semantic() on template instance members '%s'\n", toChars());
 #endif
     Scope *sc2 = argscope->push(this);
-    size_t deferred_dim = Module::deferred.dim;
+    size_t deferred_dim = Module::numDeferred();
 
     static int nest;
     //printf("%d\n", nest);
@@ -8267,7 +8637,7 @@ void TemplateMixin::semantic(Scope *sc)
 
     nest--;
 
-    if (!sc->func && Module::deferred.dim > deferred_dim)
+    if (!sc->func && Module::numDeferred() > deferred_dim)
     {
         sc2->pop();
         argscope->pop();
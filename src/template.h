@@ -66,10 +66,15 @@ public:
     TemplateParameters *origParameters; // originals for Ddoc
     Expression *constraint;
 
-    // Hash table to look up TemplateInstance's of this TemplateDeclaration
-    Array<TemplateInstances *> buckets;
+    // Hash table to look up TemplateInstance's of this TemplateDeclaration,
+    // open addressed, with a power of 2 number of slots
+    TemplateInstance **instances;
+    size_t instancesdim;                // number of slots in instances[]
     size_t numinstances;                // number of instances in the hash table
 
+    static size_t instanceLookups;      // calls to findExistingInstance()
+    static size_t instanceProbes;       // slots of instances[] they looked at
+
     TemplateDeclaration *overnext;      // next overloaded TemplateDeclaration
     TemplateDeclaration *overroot;      // first in overnext list
     FuncDeclaration *funcroot;          // first function in unified overload list
@@ -83,6 +88,13 @@ public:
 
     TemplatePrevious *previous;         // threaded list of previous instantiation attempts on stack
 
+    static unsigned numprevious;        // links of all the previous lists on the stack
+    static unsigned numrejected;        // attempts rejected as recursive
+    static unsigned numconstraints;     // calls to evaluateConstraint()
+
+    static size_t deductionLookups;     // calls to deduceFunctionTemplateMatch()
+    static size_t deductionHits;        // of them answered by an earlier deduction
+
     TemplateDeclaration(Loc loc, Identifier *id, TemplateParameters *parameters,
         Expression *constraint, Dsymbols *decldefs, bool ismixin = false, bool literal = false);
     Dsymbol *syntaxCopy(Dsymbol *);
@@ -0,0 +1,184 @@
+
+/* Compiler implementation of the D programming language
+ * Copyright (c) 1999-2014 by Digital Mars
+ * All Rights Reserved
+ * written by Walter Bright
+ * http://www.digitalmars.com
+ * Distributed under the Boost Software License, Version 1.0.
+ * http://www.boost.org/LICENSE_1_0.txt
+ * https://github.com/D-Programming-Language/dmd/blob/master/src/timetrace.c
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#if _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#include "rmem.h"
+#include "root.h"
+
+#include "dsymbol.h"
+#include "timetrace.h"
+
+struct TraceEvent
+{
+    const char *cat;
+    const char *name;
+    const char *detail;         // NULL if none
+    unsigned long long ts;      // start, in microseconds since TimeTrace::start()
+    unsigned long long dur;     // ~0 while still running
+    size_t allocated;           // bytes allocated by this thread while running
+    size_t heap;                // Mem::heapSize() at the end
+    size_t peak;                // Mem::heapPeak() at the end
+};
+
+bool TimeTrace::enabled = false;
+
+static TraceEvent *events;
+static size_t eventsDim;
+static size_t eventsAllocdim;
+static unsigned long long startTicks;
+
+/*******************************************
+ * Current time in microseconds.
+ */
+
+static unsigned long long ticks()
+{
+#if _WIN32
+    static LARGE_INTEGER freq;
+    if (!freq.QuadPart)
+        QueryPerformanceFrequency(&freq);
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (unsigned long long)(t.QuadPart / freq.QuadPart) * 1000000 +
+        (unsigned long long)(t.QuadPart % freq.QuadPart) * 1000000 / freq.QuadPart;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (unsigned long long)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+void TimeTrace::start()
+{
+    enabled = true;
+    startTicks = ticks();
+}
+
+/*******************************************
+ * Start recording an event.
+ * Returns:
+ *      handle to pass to end(), 0 if not enabled
+ */
+
+size_t TimeTrace::begin(const char *cat, const char *name)
+{
+    if (!enabled)
+        return 0;
+    if (eventsDim == eventsAllocdim)
+    {
+        eventsAllocdim = eventsAllocdim ? eventsAllocdim * 2 : 1024;
+        events = (TraceEvent *)mem.realloc(events, eventsAllocdim * sizeof(TraceEvent));
+    }
+    TraceEvent *e = &events[eventsDim++];
+    e->cat = cat;
+    e->name = name;
+    e->detail = NULL;
+    e->dur = ~0ULL;
+    e->allocated = mem.allocated();
+    e->ts = ticks() - startTicks;
+    return eventsDim;
+}
+
+/*******************************************
+ * Finish recording event i, naming it after s if s is not NULL.
+ */
+
+void TimeTrace::end(size_t i, Dsymbol *s)
+{
+    if (!i)
+        return;
+    assert(i <= eventsDim);
+    TraceEvent *e = &events[i - 1];
+    e->dur = ticks() - startTicks - e->ts;
+    e->allocated = mem.allocated() - e->allocated;
+    e->heap = mem.heapSize();
+    e->peak = mem.heapPeak();
+    if (s)
+        e->detail = s->toPrettyChars();
+}
+
+static void writeString(OutBuffer *buf, const char *s)
+{
+    buf->writeByte('"');
+    for (; *s; s++)
+    {
+        unsigned char c = *s;
+        if (c == '"' || c == '\\')
+        {
+            buf->writeByte('\\');
+            buf->writeByte(c);
+        }
+        else if (c < 0x20)
+            buf->printf("\\u%04x", c);
+        else
+            buf->writeByte(c);
+    }
+    buf->writeByte('"');
+}
+
+/*******************************************
+ * Write the events recorded so far to filename. Events that are still
+ * running, because the compiler is quitting early, end now.
+ * Returns:
+ *      false if the file could not be written
+ */
+
+bool TimeTrace::write(const char *filename)
+{
+    unsigned long long now = ticks() - startTicks;
+    size_t nallocated = mem.allocated();
+    size_t heap = mem.heapSize();
+    size_t peak = mem.heapPeak();
+
+    OutBuffer buf;
+    buf.writestring("{\"traceEvents\":[\n");
+    buf.writestring("{\"ph\":\"M\",\"pid\":1,\"tid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"dmd\"}}");
+    for (size_t i = 0; i < eventsDim; i++)
+    {
+        TraceEvent *e = &events[i];
+        if (e->dur == ~0ULL)
+        {
+            e->dur = now - e->ts;
+            e->allocated = nallocated - e->allocated;
+            e->heap = heap;
+            e->peak = peak;
+        }
+        buf.writestring(",\n{\"ph\":\"X\",\"pid\":1,\"tid\":1,\"cat\":");
+        writeString(&buf, e->cat);
+        buf.writestring(",\"name\":");
+        writeString(&buf, e->name);
+        buf.printf(",\"ts\":%llu,\"dur\":%llu,\"args\":{", e->ts, e->dur);
+        if (e->detail)
+        {
+            buf.writestring("\"detail\":");
+            writeString(&buf, e->detail);
+            buf.writeByte(',');
+        }
+        buf.printf("\"allocated\":%llu,\"heap\":%llu,\"peak\":%llu}}",
+            (unsigned long long)e->allocated, (unsigned long long)e->heap,
+            (unsigned long long)e->peak);
+    }
+    buf.writestring("\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    File f(filename);
+    f.setbuffer(buf.data, buf.offset);
+    f.ref = 1;
+    return !f.write();
+}
@@ -0,0 +1,53 @@
+
+/* Compiler implementation of the D programming language
+ * Copyright (c) 1999-2014 by Digital Mars
+ * All Rights Reserved
+ * written by Walter Bright
+ * http://www.digitalmars.com
+ * Distributed under the Boost Software License, Version 1.0.
+ * http://www.boost.org/LICENSE_1_0.txt
+ * https://github.com/D-Programming-Language/dmd/blob/master/src/timetrace.h
+ */
+
+#ifndef DMD_TIMETRACE_H
+#define DMD_TIMETRACE_H
+
+#ifdef __DMC__
+#pragma once
+#endif /* __DMC__ */
+
+#include <stddef.h>     // for size_t
+
+class Dsymbol;
+
+/* With -ftime-trace, record how long each compiler phase, and each
+ * module, function and template instance within it takes, and how much
+ * memory it allocates. The result is written in the Chrome trace event
+ * format, for viewing with chrome://tracing or similar.
+ */
+
+struct TimeTrace
+{
+    static bool enabled;
+
+    static void start();
+    static size_t begin(const char *cat, const char *name);
+    static void end(size_t i, Dsymbol *s = NULL);
+    static bool write(const char *filename);
+};
+
+/* Record the time from construction to destruction of a scope.
+ * The detail is the name of s, taken at the end so that templates
+ * show their resolved arguments.
+ */
+struct TimeTraceScope
+{
+    size_t i;
+    Dsymbol *s;
+
+    TimeTraceScope(const char *cat, const char *name, Dsymbol *s = NULL)
+        : i(TimeTrace::begin(cat, name)), s(s) {}
+    ~TimeTraceScope() { TimeTrace::end(i, s); }
+};
+
+#endif /* DMD_TIMETRACE_H */
@@ -298,18 +298,18 @@ Symbol *toSymbol(Dsymbol *s)
                     f->Fflags |= Fstatic;
                 f->Fstartline.Slinnum = fd->loc.linnum;
                 f->Fstartline.Scharnum = fd->loc.charnum;
-                f->Fstartline.Sfilename = (char *)fd->loc.filename;
+                f->Fstartline.Sfilename = (char *)fd->loc.filename();
                 if (fd->endloc.linnum)
                 {
                     f->Fendline.Slinnum = fd->endloc.linnum;
                     f->Fendline.Scharnum = fd->endloc.charnum;
-                    f->Fendline.Sfilename = (char *)fd->endloc.filename;
+                    f->Fendline.Sfilename = (char *)fd->endloc.filename();
                 }
                 else
                 {
                     f->Fendline.Slinnum = fd->loc.linnum;
                     f->Fendline.Scharnum = fd->loc.charnum;
-                    f->Fendline.Sfilename = (char *)fd->loc.filename;
+                    f->Fendline.Sfilename = (char *)fd->loc.filename();
                 }
                 TYPE *t = Type_toCtype(fd->type);
 
@@ -64,7 +64,7 @@ elem *incUsageElem(IRState *irs, Loc loc)
     unsigned linnum = loc.linnum;
 
     if (!irs->blx->module->cov || !linnum ||
-        loc.filename != irs->blx->module->srcfile->toChars())
+        !loc.filename() || strcmp(loc.filename(), irs->blx->module->srcfile->toChars()) != 0)
         return NULL;
 
     //printf("cov = %p, covb = %p, linnum = %u\n", irs->blx->module->cov, irs->blx->module->covb, p, linnum);
@@ -0,0 +1,191 @@
+unsigned tytab[] =
+{ 0x1004,0x1004,0x1004,0x1024,0x00,0x1024,0x1004,0x1024,
+  0x1024,0x04,0x04,0x24,0x04,0x24,0x24,0x04,
+  0x24,0x10002,0x10002,0x02,0x02,0x10010,0x10010,0x10,
+  0x08,0x08,0x08,0x01,0x800,0x01,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8000,0x00,0x2000,0x2000,
+  0x4000,0x00,0x4600,0x00,0x4200,0x00,0x4000,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4200,
+  0x4600,0x4000,0x8000,0x00,0x04,0x24,0x30002,0x30002,
+  0x30004,0x30024,0x30004,0x30024,0x30004,0x30024,0x30004,0x30024,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+const tym_t tytouns[] =
+{ 0x00,0x03,0x03,0x03,0x00,0x05,0x08,0x07,
+  0x08,0x0b,0x0b,0x0b,0x0d,0x0d,0x0e,0x10,
+  0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,
+  0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x24,0x25,0x26,0x27,
+  0x28,0x00,0x2a,0x00,0x2c,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x37,
+  0x38,0x39,0x3a,0x00,0x3d,0x3d,0x3e,0x3f,
+  0x41,0x41,0x43,0x43,0x45,0x45,0x47,0x47,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+signed char tysize[] =
+{ 1,1,1,1,0,2,2,2,
+  2,-1,2,2,4,4,4,8,
+  8,4,8,8,12,4,8,12,
+  8,16,24,2,2,2,0,0,
+  0,0,0,0,-1,-1,-1,-1,
+  -1,0,-1,0,-1,0,0,0,
+  0,0,0,2,0,0,0,-1,
+  -1,-1,2,0,16,16,16,16,
+  16,16,16,16,16,16,16,16,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+};
+signed char tyalignsize[] =
+{ 1,1,1,1,0,2,2,2,
+  2,-1,2,2,4,4,4,8,
+  8,4,8,8,4,4,8,4,
+  8,16,4,2,2,2,0,0,
+  0,0,0,0,-1,-1,-1,-1,
+  -1,0,-1,0,-1,0,0,0,
+  0,0,0,2,0,0,0,-1,
+  -1,-1,2,0,8,8,16,16,
+  16,16,16,16,16,16,16,16,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+};
+unsigned char _tyrelax[] =
+{ 0x01,0x01,0x01,0x01,0x00,0x0a,0x0a,0x0a,
+  0x0a,0x0a,0x0a,0x0a,0x0c,0x0c,0x0c,0x0f,
+  0x0f,0x11,0x12,0x13,0x14,0x15,0x16,0x17,
+  0x18,0x19,0x1a,0x1b,0x33,0x1d,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x24,0x25,0x26,0x27,
+  0x28,0x00,0x2a,0x00,0x2c,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x37,
+  0x38,0x39,0x3a,0x00,0x3c,0x3c,0x3e,0x3f,
+  0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,
+};
+unsigned char tyequiv[] =
+{ 0x00,0x02,0x02,0x03,0x04,0x05,0x06,0x07,
+  0x08,0x09,0x06,0x08,0x0c,0x0d,0x0e,0x0f,
+  0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,
+  0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f,
+  0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,
+  0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,
+  0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,
+  0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3e,0x3f,
+  0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,
+};
+const char *tystring[] =
+{ "bool","char","signed char","unsigned char","(null)","char16_t","short","wchar_t",
+  "unsigned short","enum","int","unsigned","long","unsigned long","dchar","long long",
+  "uns long long","float","double","double alias","long double","imaginary float","imaginary double","imaginary long double",
+  "complex float","complex double","complex long double","__near *","nullptr_t","*","(null)","(null)",
+  "(null)","(null)","(null)","(null)","&","void","struct","array",
+  "C func","(null)","Pascal func","(null)","std func","(null)","(null)","(null)",
+  "(null)","(null)","(null)","*","(null)","(null)","(null)","member func",
+  "D func","C func","__near &","(null)","cent","ucent","float[4]","double[2]",
+  "signed char[16]","unsigned char[16]","short[8]","unsigned short[8]","long[4]","unsigned long[4]","long long[2]","unsigned long long[2]",
+};
+unsigned char dttab[] =
+{ 0x80,0x80,0x80,0x84,0x00,0x85,0x81,0x85,
+  0x85,0x81,0x81,0x85,0x82,0x86,0x86,0x82,
+  0x86,0x88,0x89,0x89,0x89,0x88,0x89,0x89,
+  0x88,0x89,0x89,0x20,0x20,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x85,0x00,0x78,
+  0x63,0x00,0x74,0x00,0x63,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x64,
+  0x74,0x00,0x00,0x00,0x82,0x86,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+unsigned short dttab4[] =
+{ 0x30,0x70,0x10,0x20,0x00,0x21,0x11,0x71,
+  0x21,0x72,0x72,0x73,0x12,0x22,0x22,0x13,
+  0x23,0x40,0x41,0x41,0x42,0x40,0x41,0x42,
+  0x50,0x51,0x52,0x100,0x100,0x100,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x100,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x603,0x603,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
@@ -19,6 +19,12 @@
 /// [4] http://www.unicode.org/versions/Unicode6.1.0/ch03.pdf
 
 #include <assert.h>
+#include <string.h>
+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define UTF_SSE2 1
+#endif
 
 #include "utf.h"
 
@@ -303,3 +309,209 @@ const char *utf_decodeWchar(utf16_t const *s, size_t len, size_t *pidx, dchar_t
     *presult = u;
     return UTF16_DECODE_OK;
 }
+
+/* The bulk conversions below convert the longest prefix of s that is
+ * valid, and return how many code units of s that was. Callers finish
+ * off with utf_decodeChar() or utf_decodeWchar() from there, so that
+ * the error handling is left to them. Runs of ASCII, which are most of
+ * any source or string literal, are done 16 bytes at a time.
+ */
+
+/********************************************
+ * Returns:
+ *      the number of ASCII code units s[0 .. len] starts with
+ */
+
+size_t utf_asciiLength(utf8_t const *s, size_t len)
+{
+    size_t i = 0;
+#if UTF_SSE2
+    for (; i + 16 <= len; i += 16)
+    {
+        if (_mm_movemask_epi8(_mm_loadu_si128((__m128i const *)(s + i))))
+            break;
+    }
+#endif
+    while (i < len && s[i] < 0x80)
+        ++i;
+    return i;
+}
+
+/********************************************
+ * Convert the valid prefix of the UTF-8 s[0 .. len] to UTF-16.
+ * d must have room for len code units.
+ * Returns:
+ *      the number of code units of s converted, *pdlen is set to the
+ *      number written to d
+ */
+
+size_t utf_toUTF16(utf8_t const *s, size_t len, utf16_t *d, size_t *pdlen)
+{
+    size_t i = 0;
+    utf16_t *q = d;
+    while (i < len)
+    {
+#if UTF_SSE2
+        __m128i const zero = _mm_setzero_si128();
+        for (; i + 16 <= len; i += 16, q += 16)
+        {
+            __m128i v = _mm_loadu_si128((__m128i const *)(s + i));
+            if (_mm_movemask_epi8(v))
+                break;
+            _mm_storeu_si128((__m128i *)q, _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128((__m128i *)(q + 8), _mm_unpackhi_epi8(v, zero));
+        }
+#endif
+        while (i < len && s[i] < 0x80)
+            *q++ = s[i++];
+        if (i == len)
+            break;
+        dchar_t c;
+        size_t n = utf_decodeMultibyte(s + i, len - i, &c);
+        if (!n)
+            break;
+        i += n;
+        if (c <= 0xFFFF)
+            *q++ = (utf16_t)c;
+        else
+        {
+            utf_encodeWchar(q, c);
+            q += 2;
+        }
+    }
+    *pdlen = q - d;
+    return i;
+}
+
+/********************************************
+ * Convert the valid prefix of the UTF-8 s[0 .. len] to UTF-32.
+ * d must have room for len code units.
+ * Returns:
+ *      the number of code units of s converted, *pdlen is set to the
+ *      number written to d
+ */
+
+size_t utf_toUTF32(utf8_t const *s, size_t len, utf32_t *d, size_t *pdlen)
+{
+    size_t i = 0;
+    utf32_t *q = d;
+    while (i < len)
+    {
+#if UTF_SSE2
+        __m128i const zero = _mm_setzero_si128();
+        for (; i + 16 <= len; i += 16, q += 16)
+        {
+            __m128i v = _mm_loadu_si128((__m128i const *)(s + i));
+            if (_mm_movemask_epi8(v))
+                break;
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128((__m128i *)q, _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(q + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(q + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i *)(q + 12), _mm_unpackhi_epi16(hi, zero));
+        }
+#endif
+        while (i < len && s[i] < 0x80)
+            *q++ = s[i++];
+        if (i == len)
+            break;
+        size_t n = utf_decodeMultibyte(s + i, len - i, q);
+        if (!n)
+            break;
+        i += n;
+        ++q;
+    }
+    *pdlen = q - d;
+    return i;
+}
+
+/********************************************
+ * Convert the valid prefix of the UTF-16 s[0 .. len] to UTF-8.
+ * d must have room for 3 * len code units.
+ * Returns:
+ *      the number of code units of s converted, *pdlen is set to the
+ *      number written to d
+ */
+
+size_t utf_fromUTF16(utf16_t const *s, size_t len, utf8_t *d, size_t *pdlen)
+{
+    size_t i = 0;
+    utf8_t *q = d;
+    while (i < len)
+    {
+#if UTF_SSE2
+        __m128i const zero = _mm_setzero_si128();
+        __m128i const nonascii = _mm_set1_epi16((short)0xFF80);
+        for (; i + 8 <= len; i += 8, q += 8)
+        {
+            __m128i v = _mm_loadu_si128((__m128i const *)(s + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, nonascii), zero)) != 0xFFFF)
+                break;
+            _mm_storel_epi64((__m128i *)q, _mm_packus_epi16(v, v));
+        }
+#endif
+        while (i < len && s[i] < 0x80)
+            *q++ = (utf8_t)s[i++];
+        if (i == len)
+            break;
+        dchar_t c = s[i];
+        if (0xD800 <= c && c <= 0xDBFF)
+        {
+            if (i + 1 == len || s[i + 1] < 0xDC00 || s[i + 1] > 0xDFFF)
+                break;
+            c = ((c - 0xD7C0) << 10) + (s[i + 1] - 0xDC00);
+            i += 2;
+        }
+        else if ((0xDC00 <= c && c <= 0xDFFF) || c >= 0xFFFE)
+            break;
+        else
+            ++i;
+        utf_encodeChar(q, c);
+        q += utf_codeLengthChar(c);
+    }
+    *pdlen = q - d;
+    return i;
+}
+
+/********************************************
+ * Convert the valid prefix of the UTF-32 s[0 .. len] to UTF-8.
+ * d must have room for 4 * len code units.
+ * Returns:
+ *      the number of code units of s converted, *pdlen is set to the
+ *      number written to d
+ */
+
+size_t utf_fromUTF32(utf32_t const *s, size_t len, utf8_t *d, size_t *pdlen)
+{
+    size_t i = 0;
+    utf8_t *q = d;
+    while (i < len)
+    {
+#if UTF_SSE2
+        __m128i const zero = _mm_setzero_si128();
+        __m128i const nonascii = _mm_set1_epi32((int)0xFFFFFF80);
+        for (; i + 4 <= len; i += 4, q += 4)
+        {
+            __m128i v = _mm_loadu_si128((__m128i const *)(s + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, nonascii), zero)) != 0xFFFF)
+                break;
+            v = _mm_packs_epi32(v, v);
+            int w = _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+            memcpy(q, &w, 4);
+        }
+#endif
+        while (i < len && s[i] < 0x80)
+            *q++ = (utf8_t)s[i++];
+        if (i == len)
+            break;
+        dchar_t c = s[i];
+        if (!utf_isValidDchar(c))
+            break;
+        ++i;
+        utf_encodeChar(q, c);
+        q += utf_codeLengthChar(c);
+    }
+    *pdlen = q - d;
+    return i;
+}
@@ -118,4 +118,53 @@ void utf_encode(int sz, void *s, dchar_t c);
 const char *utf_decodeChar(utf8_t const *s, size_t len, size_t *pidx, dchar_t *presult);
 const char *utf_decodeWchar(utf16_t const *s, size_t len, size_t *pidx, dchar_t *presult);
 
+/********************************************
+ * Decode the multi-byte UTF-8 sequence at s[0 .. len], accepting exactly
+ * what utf_decodeChar() accepts, without an error message.
+ * s[1 .. ] is only read as far as the sequence stays valid, so a 0
+ * terminated s may be passed with a len of 4.
+ * Returns:
+ *      the length of the sequence, 0 if it is not valid (or ASCII)
+ */
+
+inline size_t utf_decodeMultibyte(utf8_t const *s, size_t len, dchar_t *presult)
+{
+    utf32_t u = s[0];
+    if (u < 0xC2 || u > 0xF4)           // ASCII, trailer, overlong or > 0x10FFFF
+        return 0;
+    if (len < 2 || (s[1] & 0xC0) != 0x80)
+        return 0;
+    utf32_t c = ((u & 0x1F) << 6) | (s[1] & 0x3F);
+    if (u < 0xE0)
+    {
+        *presult = c;
+        return 2;
+    }
+    if (len < 3 || (s[2] & 0xC0) != 0x80)
+        return 0;
+    c = ((c & 0x3FF) << 6) | (s[2] & 0x3F);
+    if (u < 0xF0)
+    {
+        // overlong, surrogate or non-character
+        if (c < 0x800 || (0xD800 <= c && c <= 0xDFFF) || c >= 0xFFFE)
+            return 0;
+        *presult = c;
+        return 3;
+    }
+    if (len < 4 || (s[3] & 0xC0) != 0x80)
+        return 0;
+    c = ((c & 0x7FFF) << 6) | (s[3] & 0x3F);
+    if (c < 0x10000 || c > 0x10FFFF)
+        return 0;
+    *presult = c;
+    return 4;
+}
+
+size_t utf_asciiLength(utf8_t const *s, size_t len);
+
+size_t utf_toUTF16(utf8_t const *s, size_t len, utf16_t *d, size_t *pdlen);
+size_t utf_toUTF32(utf8_t const *s, size_t len, utf32_t *d, size_t *pdlen);
+size_t utf_fromUTF16(utf16_t const *s, size_t len, utf8_t *d, size_t *pdlen);
+size_t utf_fromUTF32(utf32_t const *s, size_t len, utf8_t *d, size_t *pdlen);
+
 #endif  // DMD_UTF_H
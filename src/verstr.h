@@ -0,0 +1 @@
+"2.066-devel-f67361c-dirty"
\ No newline at end of file
@@ -141,7 +141,7 @@ FRONTOBJ= enum.obj struct.obj dsymbol.obj import.obj id.obj \
 	builtin.obj clone.obj arrayop.obj \
 	json.obj unittests.obj imphint.obj argtypes.obj apply.obj sapply.obj \
 	sideeffect.obj intrange.obj canthrow.obj target.obj nspace.obj \
-	color.obj
+	color.obj server.obj timetrace.obj memstats.obj
 
 # Glue layer
 GLUEOBJ=glue.obj msc.obj s2ir.obj todt.obj e2ir.obj tocsym.obj \
@@ -189,7 +189,8 @@ SRCS= mars.c enum.c struct.c dsymbol.c import.c idgen.c impcnvgen.c utf.h \
 	clone.c lib.h arrayop.c nspace.h nspace.c color.h color.c \
 	aliasthis.h aliasthis.c json.h json.c unittests.c imphint.c argtypes.c \
 	apply.c sapply.c sideeffect.c ctfe.h \
-	intrange.h intrange.c canthrow.c target.c target.h visitor.h
+	intrange.h intrange.c canthrow.c target.c target.h visitor.h \
+	server.h server.c timetrace.h timetrace.c memstats.h memstats.c
 
 # Glue layer
 GLUESRC= glue.c msc.c s2ir.c todt.c e2ir.c tocsym.c \
@@ -305,7 +306,7 @@ clean:
 	$(DEL) msgs.h msgs.c
 	$(DEL) elxxx.c cdxxx.c optab.c debtab.c fltables.c tytab.c
 	$(DEL) impcnvtab.c
-	$(DEL) id.h id.c
+	$(DEL) id.h id.c kwtab.c
 	$(DEL) verstr.h
 
 install: detab install-copy
@@ -377,7 +378,7 @@ impcnvtab.c : impcnvgen.c
 	$(CC) -I$(ROOT) -cpp -DDM_TARGET_CPU_X86=1 impcnvgen
 	impcnvgen
 
-id.h id.c : idgen.c
+id.h id.c kwtab.c : idgen.c
 	$(CC) -cpp -DDM_TARGET_CPU_X86=1 idgen
 	idgen
 
@@ -702,7 +703,7 @@ interpret.obj : $(TOTALH) interpret.c declaration.h expression.h ctfe.h
 ctfexpr.obj : $(TOTALH) ctfeexpr.c ctfe.h
 intrange.obj : $(TOTALH) intrange.h intrange.c
 json.obj : $(TOTALH) json.h json.c
-lexer.obj : $(TOTALH) lexer.c
+lexer.obj : $(TOTALH) lexer.c kwtab.c
 libmscoff.obj : $(TOTALH) lib.h libmscoff.c
 libomf.obj : $(TOTALH) lib.h libomf.c
 link.obj : $(TOTALH) link.c
@@ -715,11 +716,14 @@ parse.obj : $(TOTALH) attrib.h lexer.h parse.h parse.c
 sapply.obj : $(TOTALH) sapply.c
 scanomf.obj : $(TOTALH) lib.h scanomf.c
 scope.obj : $(TOTALH) scope.h scope.c
+server.obj : $(TOTALH) server.h server.c
 sideeffect.obj : $(TOTALH) sideeffect.c
 statement.obj : $(TOTALH) statement.h statement.c expression.h
 staticassert.obj : $(TOTALH) staticassert.h staticassert.c
 struct.obj : $(TOTALH) identifier.h enum.h struct.c
 target.obj : $(TOTALH) target.c target.h
+timetrace.obj : $(TOTALH) timetrace.h timetrace.c
+memstats.obj : $(TOTALH) memstats.h memstats.c
 traits.obj : $(TOTALH) traits.c
 dsymbol.obj : $(TOTALH) identifier.h dsymbol.h dsymbol.c
 mtype.obj : $(TOTALH) mtype.h mtype.c
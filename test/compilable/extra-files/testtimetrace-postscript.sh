@@ -0,0 +1,23 @@
+#!/usr/bin/env bash
+
+json=${RESULTS_DIR}/compilable/testtimetrace.json
+
+check()
+{
+    if ! grep -q "$1" ${json}; then
+        echo "${json} lacks $1"
+        exit 1
+    fi
+}
+
+check '^{"traceEvents":\['
+for phase in parse importAll semantic1 semantic2 semantic3 codegen; do
+    check "\"cat\":\"phase\",\"name\":\"${phase}\""
+done
+check '"cat":"module","name":"semantic3",.*"detail":"testtimetrace"'
+check '"cat":"function","name":"semantic3",.*"detail":"testtimetrace.foo"'
+check '"cat":"template","name":"instantiate",.*"detail":"testtimetrace.S!int"'
+check '"allocated":[0-9]*,"heap":[1-9][0-9]*,"peak":[1-9][0-9]*}}'
+check '"displayTimeUnit":"ms"}$'
+
+rm ${json}